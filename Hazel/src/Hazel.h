@@ -16,10 +16,20 @@
 
 #include "Hazel/Renderer/Buffer.h"
 #include "Hazel/Renderer/Texture.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+#include "Hazel/Renderer/TextureAtlas.h"
 #include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/ShaderCache.h"
+#include "Hazel/Renderer/ShaderLibrary.h"
 #include "Hazel/Renderer/VertexArray.h"
+#include "Hazel/Renderer/Framebuffer.h"
+#include "Hazel/Renderer/UniformBuffer.h"
+#include "Hazel/Renderer/StorageBuffer.h"
+#include "Hazel/Renderer/Material.h"
 #include "Hazel/Renderer/Renderer.h"
 #include "Hazel/Renderer/Renderer2D.h"
+#include "Hazel/Renderer/StaticBatch2D.h"
+#include "Hazel/Renderer/SpriteBatch2D.h"
 #include "Hazel/Renderer/RenderCommand.h"
 
 #include "Hazel/Camera/OrthographicCamera.h"
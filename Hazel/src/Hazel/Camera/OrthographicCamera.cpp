@@ -3,6 +3,8 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <cfloat>
+
 namespace Hazel {
 
 	OrthographicCamera::OrthographicCamera(float left, float right, float bottom, float top)
@@ -16,8 +18,14 @@ namespace Hazel {
 
 	void OrthographicCamera::SetProjection(float left, float right, float bottom, float top)
 	{
+		m_Left = left;
+		m_Right = right;
+		m_Bottom = bottom;
+		m_Top = top;
+
 		m_ProjectionMatrix = glm::ortho(left, right, bottom, top, -1.0f, 1.0f);
 		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		RecalculateVisibleBounds();
 	}
 
 	void OrthographicCamera::RecalculateViewMatrix()
@@ -28,6 +36,33 @@ namespace Hazel {
 
 		m_ViewMatrix = glm::inverse(transform);
 		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		RecalculateVisibleBounds();
+	}
+
+	void OrthographicCamera::RecalculateVisibleBounds()
+	{
+		// Bounding box of the projection rectangle rotated and moved with the camera
+		float rotation = glm::radians(m_Rotation);
+		float c = cosf(rotation), s = sinf(rotation);
+
+		glm::vec2 corners[4] = {
+			{ m_Left,  m_Bottom },
+			{ m_Right, m_Bottom },
+			{ m_Right, m_Top    },
+			{ m_Left,  m_Top    }
+		};
+
+		m_VisibleMin = glm::vec2(FLT_MAX);
+		m_VisibleMax = glm::vec2(-FLT_MAX);
+		for (const auto& corner : corners)
+		{
+			glm::vec2 world = {
+				m_Position.x + corner.x * c - corner.y * s,
+				m_Position.y + corner.x * s + corner.y * c
+			};
+			m_VisibleMin = glm::min(m_VisibleMin, world);
+			m_VisibleMax = glm::max(m_VisibleMax, world);
+		}
 	}
 
 }
\ No newline at end of file
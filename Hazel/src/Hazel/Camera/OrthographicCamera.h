@@ -29,8 +29,13 @@ namespace Hazel {
 		const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
 		const glm::mat4& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; }
 
+		// World space rectangle enclosing everything the camera sees, for culling
+		const glm::vec2& GetVisibleMin() const { return m_VisibleMin; }
+		const glm::vec2& GetVisibleMax() const { return m_VisibleMax; }
+
 	private:
 		void RecalculateViewMatrix();
+		void RecalculateVisibleBounds();
 
 	private:
 		glm::mat4 m_ProjectionMatrix;
@@ -39,6 +44,9 @@ namespace Hazel {
 
 		glm::vec3 m_Position;
 		float m_Rotation;
+
+		float m_Left, m_Right, m_Bottom, m_Top;
+		glm::vec2 m_VisibleMin, m_VisibleMax;
 	};
 
 }
\ No newline at end of file
@@ -12,7 +12,7 @@ namespace Hazel {
 
 	Application* Application::s_Instance = nullptr;
 
-	Application::Application()
+	Application::Application(uint32_t framesInFlight)
 	{
 		HZ_PROFILE_FUNCTION()
 
@@ -22,6 +22,9 @@ namespace Hazel {
 		m_Window = std::unique_ptr<Window>(Window::Create());
 		m_Window->SetEventCallback(HZ_BIND_EVENT_FN(Application::OnEvent));
 
+		if (RendererAPI::GetAPI() == RendererAPI::API::OpenGL && framesInFlight > 0)
+			RenderCommand::StartRenderThread(m_Window->GetContext(), framesInFlight);
+
 		Renderer::Init();
 
 		m_ImGuiLayer = new ImGuiLayer();
@@ -31,6 +34,9 @@ namespace Hazel {
 	Application::~Application()
 	{
 		HZ_PROFILE_FUNCTION()
+
+		// Layers release their resources with the context back on this thread
+		RenderCommand::StopRenderThread();
 	}
 
 	void Application::Run()
@@ -69,6 +75,7 @@ namespace Hazel {
 			}
 
 			m_Window->OnUpdate();
+			RenderCommand::EndFrame();
 
 			if (Input::IsKeyPressed(HZ_KEY_ESCAPE))
 				OnWindowClose(WindowCloseEvent());
@@ -12,7 +12,9 @@ namespace Hazel {
 	class Application
 	{
 	public:
-		HAZEL_API Application();
+		// framesInFlight is how many frames a render thread may lag behind, 0 renders on the main thread.
+		// The render thread turns off Renderer2DSettings::StreamingBuffer and ImGui viewports.
+		HAZEL_API Application(uint32_t framesInFlight = 0);
 		HAZEL_API virtual ~Application();
 
 		HAZEL_API void Run();
@@ -0,0 +1,119 @@
+#include "hzpch.h"
+#include "ThreadPool.h"
+
+namespace Hazel {
+
+	ThreadPool::ThreadPool(uint32_t threadCount)
+	{
+		if (threadCount == 0)
+			threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+		for (uint32_t i = 1; i < threadCount; i++)
+			m_Workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Quit = true;
+		}
+		m_WakeCondition.notify_all();
+
+		for (auto& worker : m_Workers)
+			worker.join();
+	}
+
+	void ThreadPool::ParallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& job)
+	{
+		if (count == 0)
+			return;
+
+		// Not worth waking the workers for
+		if (count == 1 || m_Workers.empty())
+		{
+			for (uint32_t i = 0; i < count; i++)
+				job(i, 0);
+			return;
+		}
+
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Job = &job;
+			m_JobCount = count;
+			m_NextIndex = 0;
+			m_BusyWorkers = (uint32_t)m_Workers.size();
+			m_Generation++;
+		}
+		m_WakeCondition.notify_all();
+
+		RunJobs(0);
+
+		std::unique_lock lock(m_Mutex);
+		m_DoneCondition.wait(lock, [this] { return m_BusyWorkers == 0; });
+		m_Job = nullptr;
+	}
+
+	void ThreadPool::Submit(std::function<void()> task)
+	{
+		if (m_Workers.empty())
+		{
+			task();
+			return;
+		}
+
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Tasks.push(std::move(task));
+		}
+		m_WakeCondition.notify_one();
+	}
+
+	void ThreadPool::WorkerLoop(uint32_t thread)
+	{
+		uint32_t generation = 0;
+
+		while (true)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock lock(m_Mutex);
+				m_WakeCondition.wait(lock, [&] { return m_Quit || m_Generation != generation || !m_Tasks.empty(); });
+
+				if (m_Generation != generation)
+				{
+					generation = m_Generation;
+				}
+				else if (!m_Tasks.empty())
+				{
+					task = std::move(m_Tasks.front());
+					m_Tasks.pop();
+				}
+				else
+				{
+					return; // Quit
+				}
+			}
+
+			if (task)
+			{
+				task();
+				continue;
+			}
+
+			RunJobs(thread);
+
+			std::lock_guard lock(m_Mutex);
+			if (--m_BusyWorkers == 0)
+				m_DoneCondition.notify_one();
+		}
+	}
+
+	void ThreadPool::RunJobs(uint32_t thread)
+	{
+		uint32_t index;
+		while ((index = m_NextIndex.fetch_add(1)) < m_JobCount)
+			(*m_Job)(index, thread);
+	}
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Hazel {
+
+	// Fixed set of worker threads for data parallel loops and background tasks. The calling
+	// thread takes part in every loop, so a pool of N threads starts N - 1 workers.
+	class HAZEL_API ThreadPool
+	{
+	public:
+		// 0 = one thread per hardware thread
+		ThreadPool(uint32_t threadCount = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		// Including the calling thread
+		inline uint32_t GetThreadCount() const { return (uint32_t)m_Workers.size() + 1; }
+
+		// Runs job(index, thread) for every index in [0, count) and returns once all have finished.
+		// thread is in [0, GetThreadCount()), 0 being the calling thread. Not reentrant.
+		void ParallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& job);
+
+		// Queues task for the next free worker and returns right away. Loops go first, queued
+		// tasks still run when the pool is destroyed. Runs task on the calling thread when the
+		// pool has no workers.
+		void Submit(std::function<void()> task);
+
+	private:
+		void WorkerLoop(uint32_t thread);
+		void RunJobs(uint32_t thread);
+
+	private:
+		std::vector<std::thread> m_Workers;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_WakeCondition;
+		std::condition_variable m_DoneCondition;
+
+		std::queue<std::function<void()>> m_Tasks;
+
+		const std::function<void(uint32_t, uint32_t)>* m_Job = nullptr;
+		uint32_t m_JobCount = 0;
+		std::atomic<uint32_t> m_NextIndex{ 0 };
+
+		uint32_t m_Generation = 0;    // Bumped for every ParallelFor, wakes the workers
+		uint32_t m_BusyWorkers = 0;
+		bool m_Quit = false;
+	};
+
+}
@@ -2,6 +2,7 @@
 #include "ImGuiLayer.h"
 
 #include "Hazel/Core/Application.h"
+#include "Hazel/Renderer/RenderCommand.h"
 #include "Platform/Windows/WindowsWindow.h"
 
 #include "imgui.h"
@@ -13,6 +14,25 @@
 
 namespace Hazel {
 
+	static ImDrawData* CloneDrawData(const ImDrawData* source)
+	{
+		ImDrawData* drawData = IM_NEW(ImDrawData)(*source);
+		drawData->CmdLists = source->CmdListsCount ? new ImDrawList*[source->CmdListsCount] : nullptr;
+		for (int i = 0; i < source->CmdListsCount; i++)
+			drawData->CmdLists[i] = source->CmdLists[i]->CloneOutput();
+
+		return drawData;
+	}
+
+	static void DestroyDrawData(ImDrawData* drawData)
+	{
+		for (int i = 0; i < drawData->CmdListsCount; i++)
+			IM_DELETE(drawData->CmdLists[i]);
+
+		delete[] drawData->CmdLists;
+		IM_DELETE(drawData);
+	}
+
 	ImGuiLayer::ImGuiLayer() :
 		Layer("ImGuiLayer")
 	{
@@ -31,7 +51,15 @@ namespace Hazel {
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;        // Enable Keyboard Controls
 		//io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;       // Enable Gamepad Controls
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;            // Enable Docking
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;          // Enable Multi-Viewport / Platform Windows
+		// Platform windows need their contexts on the main thread
+		if (!RenderCommand::IsThreaded())
+		{
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;      // Enable Multi-Viewport / Platform Windows
+		}
+		else
+		{
+			HZ_CORE_WARN("ImGui multi-viewports are not available with a render thread")
+		}
 		//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoTaskBarIcons;
 		//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoMerge;
 
@@ -52,12 +80,18 @@ namespace Hazel {
 
 		// Setup Platform/Renderer bindings
 		ImGui_ImplGlfw_InitForOpenGL(window, true);
-		ImGui_ImplOpenGL3_Init("#version 410");
+
+		// Creating the device objects builds the font atlas, which ImGui::NewFrame expects
+		RenderCommand::SubmitAndWait([]()
+		{
+			ImGui_ImplOpenGL3_Init("#version 410");
+			ImGui_ImplOpenGL3_NewFrame();
+		});
 	}
 
 	void ImGuiLayer::OnDetach()
 	{
-		ImGui_ImplOpenGL3_Shutdown();
+		RenderCommand::SubmitAndWait([]() { ImGui_ImplOpenGL3_Shutdown(); });
 		ImGui_ImplGlfw_Shutdown();
 		ImGui::DestroyContext();
 	}
@@ -66,7 +100,7 @@ namespace Hazel {
 
 	void ImGuiLayer::Begin()
 	{
-		ImGui_ImplOpenGL3_NewFrame();
+		RenderCommand::Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 	}
@@ -79,7 +113,16 @@ namespace Hazel {
 
 		// Rendering
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		if (RenderCommand::IsThreaded())
+		{
+			// The draw lists are rebuilt by the next frame before this one has been rendered
+			std::shared_ptr<ImDrawData> drawData(CloneDrawData(ImGui::GetDrawData()), DestroyDrawData);
+			RenderCommand::Submit([drawData]() { ImGui_ImplOpenGL3_RenderDrawData(drawData.get()); });
+		}
+		else
+		{
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		}
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
@@ -4,6 +4,8 @@
 #include "Renderer.h"
 
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Null/NullBuffer.h"
+#include "Platform/Software/SoftwareBuffer.h"
 
 namespace Hazel {
 
@@ -18,6 +20,12 @@ namespace Hazel {
 			case RendererAPI::API::OpenGL:
 				return std::make_shared<OpenGLVertexBuffer>(size);
 
+			case RendererAPI::API::Null:
+				return std::make_shared<NullVertexBuffer>(size);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareVertexBuffer>(size);
+
 			default:
 				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 				return nullptr;
@@ -35,6 +43,35 @@ namespace Hazel {
 			case RendererAPI::API::OpenGL:
 				return std::make_shared<OpenGLVertexBuffer>(vertices, size);
 
+			case RendererAPI::API::Null:
+				return std::make_shared<NullVertexBuffer>(vertices, size);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareVertexBuffer>(vertices, size);
+
+			default:
+				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
+				return nullptr;
+		}
+	}
+
+	Ref<StreamingVertexBuffer> StreamingVertexBuffer::Create(uint32_t regionSize, uint32_t regionCount)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!")
+				return nullptr;
+
+			case RendererAPI::API::OpenGL:
+				return std::make_shared<OpenGLStreamingVertexBuffer>(regionSize, regionCount);
+
+			case RendererAPI::API::Null:
+				return std::make_shared<NullStreamingVertexBuffer>(regionSize, regionCount);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareStreamingVertexBuffer>(regionSize, regionCount);
+
 			default:
 				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 				return nullptr;
@@ -52,6 +89,12 @@ namespace Hazel {
 			case RendererAPI::API::OpenGL:
 				return std::make_shared<OpenGLIndexBuffer>(indices, count);
 
+			case RendererAPI::API::Null:
+				return std::make_shared<NullIndexBuffer>(indices, count);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareIndexBuffer>(indices, count);
+
 			default:
 				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 				return nullptr;
@@ -4,7 +4,7 @@ namespace Hazel {
 
 	enum class ShaderDataType
 	{
-		None = 0, Bool, Float, Float2, Float3, Float4, Int, Int2, Int3, Int4, Mat3, Mat4
+		None = 0, Bool, Float, Float2, Float3, Float4, Int, Int2, Int3, Int4, UInt, UByte4, UShort2, Mat3, Mat4
 	};
 
 	static uint32_t ShaderDataTypeSize(ShaderDataType type)
@@ -20,6 +20,9 @@ namespace Hazel {
 			case ShaderDataType::Int2:      return 8;
 			case ShaderDataType::Int3:      return 12;
 			case ShaderDataType::Int4:      return 16;
+			case ShaderDataType::UInt:      return 4;
+			case ShaderDataType::UByte4:    return 4;
+			case ShaderDataType::UShort2:   return 4;
 			case ShaderDataType::Mat3:      return 36;
 			case ShaderDataType::Mat4:      return 64;
 		}
@@ -32,7 +35,7 @@ namespace Hazel {
 	{
 		BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
 			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0),
-			  Normalized(normalized) {}
+			  Normalized(normalized), Location(-1) {}
 
 		uint32_t GetComponentCount() const
 		{
@@ -47,6 +50,9 @@ namespace Hazel {
 				case ShaderDataType::Int2:      return 2;
 				case ShaderDataType::Int3:      return 3;
 				case ShaderDataType::Int4:      return 4;
+				case ShaderDataType::UInt:      return 1;
+				case ShaderDataType::UByte4:    return 4;
+				case ShaderDataType::UShort2:   return 2;
 				case ShaderDataType::Mat3:      return 9;
 				case ShaderDataType::Mat4:      return 16;
 			}
@@ -55,19 +61,52 @@ namespace Hazel {
 			return 0;
 		}
 
+		// Matrices take one attribute location per column
+		uint32_t GetLocationCount() const
+		{
+			switch (Type)
+			{
+				case ShaderDataType::Mat3:      return 3;
+				case ShaderDataType::Mat4:      return 4;
+			}
+
+			return 1;
+		}
+
+		// Integer attributes that reach the shader as int/uint instead of being converted to float
+		bool IsInteger() const
+		{
+			switch (Type)
+			{
+				case ShaderDataType::Int:
+				case ShaderDataType::Int2:
+				case ShaderDataType::Int3:
+				case ShaderDataType::Int4:
+				case ShaderDataType::UInt:
+					return true;
+
+				case ShaderDataType::UByte4:
+				case ShaderDataType::UShort2:
+					return !Normalized;
+			}
+
+			return false;
+		}
+
 		std::string Name;
 		ShaderDataType Type;
 		uint32_t Offset;
 		uint32_t Size;
 		bool Normalized;
+		int32_t Location; // -1 = the one after the previous element, see ShaderReflection::ResolveLocations
 	};
 
 	class BufferLayout
 	{
 	public:
-		BufferLayout() : m_Stride(0) {}
-		BufferLayout(const std::initializer_list<BufferElement>& elements)
-			: m_Elements(elements), m_Stride(0)
+		BufferLayout() : m_Stride(0), m_Instanced(false) {}
+		BufferLayout(const std::initializer_list<BufferElement>& elements, bool instanced = false)
+			: m_Elements(elements), m_Stride(0), m_Instanced(instanced)
 		{
 			CalculateOffsetsAndStride();
 		}
@@ -75,6 +114,9 @@ namespace Hazel {
 		inline const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 		inline uint32_t GetStride() const { return m_Stride; }
 
+		// Instanced layouts advance once per instance instead of once per vertex
+		inline bool IsInstanced() const { return m_Instanced; }
+
 		std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
 		std::vector<BufferElement>::iterator end() { return m_Elements.end(); }
 		std::vector<BufferElement>::const_iterator begin() const { return m_Elements.begin(); }
@@ -97,6 +139,7 @@ namespace Hazel {
 	private:
 		std::vector<BufferElement> m_Elements;
 		uint32_t m_Stride;
+		bool m_Instanced;
 	};
 
 	class HAZEL_API VertexBuffer
@@ -110,12 +153,33 @@ namespace Hazel {
 		virtual const BufferLayout& GetLayout() const = 0;
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 
-		virtual void SetData(const void* data, uint32_t size) = 0;
+		// offset is in bytes from the start of the buffer
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
 		
 		static Ref<VertexBuffer> Create(uint32_t size);
 		static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
 	};
 
+	// Vertex buffer split into regions that stay mapped for its whole lifetime. Each batch writes
+	// into the next region while the GPU may still be reading the previous ones, and every region
+	// is fenced so it is only reused once the draws reading it have completed.
+	class HAZEL_API StreamingVertexBuffer : public VertexBuffer
+	{
+	public:
+		virtual ~StreamingVertexBuffer() {}
+
+		// Advances to the next region, waiting for the GPU if it still reads from it
+		virtual void* BeginRegion() = 0;
+		// Must be called after the draws reading from the current region have been issued
+		virtual void EndRegion() = 0;
+
+		// Byte offset of the current region from the start of the buffer
+		virtual uint32_t GetRegionOffset() const = 0;
+		virtual uint32_t GetRegionSize() const = 0;
+
+		static Ref<StreamingVertexBuffer> Create(uint32_t regionSize, uint32_t regionCount = 3);
+	};
+
 	// Currently Hazel only supports 32-bit index buffers
 	class HAZEL_API IndexBuffer
 	{
@@ -4,6 +4,8 @@
 #include "Renderer.h"
 
 #include "Platform/OpenGL/OpenGLFramebuffer.h"
+#include "Platform/Null/NullFramebuffer.h"
+#include "Platform/Software/SoftwareFramebuffer.h"
 
 namespace Hazel {
 
@@ -18,6 +20,12 @@ namespace Hazel {
 			case RendererAPI::API::OpenGL:
 				return new OpenGLFramebuffer(type, width, height);
 
+			case RendererAPI::API::Null:
+				return new NullFramebuffer(type, width, height);
+
+			case RendererAPI::API::Software:
+				return new SoftwareFramebuffer(type, width, height);
+
 			default:
 				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 					return nullptr;
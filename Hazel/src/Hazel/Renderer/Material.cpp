@@ -0,0 +1,44 @@
+#include "hzpch.h"
+#include "Material.h"
+
+namespace Hazel {
+
+	Material::Material(const Ref<Shader>& shader)
+		: m_Shader(shader)
+	{
+	}
+
+	template<typename T>
+	static void SetBinding(std::vector<std::pair<uint32_t, Ref<T>>>& bindings, uint32_t index, const Ref<T>& value)
+	{
+		for (auto& binding : bindings)
+		{
+			if (binding.first == index)
+			{
+				binding.second = value;
+				return;
+			}
+		}
+		bindings.emplace_back(index, value);
+	}
+
+	void Material::SetTexture(uint32_t slot, const Ref<Texture2D>& texture)
+	{
+		SetBinding(m_Textures, slot, texture);
+	}
+
+	void Material::SetUniformBuffer(uint32_t binding, const Ref<UniformBuffer>& uniformBuffer)
+	{
+		SetBinding(m_UniformBuffers, binding, uniformBuffer);
+	}
+
+	void Material::Bind() const
+	{
+		for (const auto& [slot, texture] : m_Textures)
+			texture->Bind(slot);
+
+		for (const auto& [binding, uniformBuffer] : m_UniformBuffers)
+			uniformBuffer->Bind(binding);
+	}
+
+}
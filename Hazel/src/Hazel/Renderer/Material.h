@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/Texture.h"
+#include "Hazel/Renderer/UniformBuffer.h"
+
+namespace Hazel {
+
+	// Shader with the textures and uniform buffers it reads besides SceneData. Renderer sorts its
+	// draws, so anything a draw needs has to come with its material rather than be bound by hand.
+	class HAZEL_API Material
+	{
+	public:
+		Material(const Ref<Shader>& shader);
+
+		void SetTexture(uint32_t slot, const Ref<Texture2D>& texture);
+		void SetUniformBuffer(uint32_t binding, const Ref<UniformBuffer>& uniformBuffer);
+
+		// Drawn after every opaque draw, back to front
+		void SetTransparent(bool transparent) { m_Transparent = transparent; }
+		bool IsTransparent() const { return m_Transparent; }
+
+		inline const Ref<Shader>& GetShader() const { return m_Shader; }
+
+		// Binds the textures and uniform buffers, not the shader
+		void Bind() const;
+
+	private:
+		Ref<Shader> m_Shader;
+		std::vector<std::pair<uint32_t, Ref<Texture2D>>> m_Textures;
+		std::vector<std::pair<uint32_t, Ref<UniformBuffer>>> m_UniformBuffers;
+		bool m_Transparent = false;
+	};
+
+}
@@ -1,10 +1,44 @@
 #include "hzpch.h"
 #include "RenderCommand.h"
 
-#include <Platform/OpenGL/OpenGLRendererAPI.h>
-
 namespace Hazel {
 
-	RendererAPI* RenderCommand::s_RendererAPI = new OpenGLRendererAPI();
+	RendererAPI* RenderCommand::s_RendererAPI = nullptr;
+	std::unique_ptr<RenderThread> RenderCommand::s_RenderThread;
+
+	void RenderCommand::StartRenderThread(GraphicsContext* context, uint32_t framesInFlight)
+	{
+		HZ_CORE_ASSERT(!s_RenderThread, "Render thread is already running!")
+		s_RenderThread = std::make_unique<RenderThread>(context, framesInFlight);
+	}
+
+	void RenderCommand::StopRenderThread()
+	{
+		s_RenderThread.reset();
+	}
+
+	void RenderCommand::EndFrame()
+	{
+		if (s_RenderThread)
+			s_RenderThread->EndFrame();
+	}
+
+	void RenderCommand::SubmitAndWait(const std::function<void()>& func)
+	{
+		if (!s_RenderThread || s_RenderThread->IsCurrentThread())
+			func();
+		else
+			s_RenderThread->ExecuteAndWait(func);
+	}
+
+	const void* RenderCommand::CopyData(const void* data, uint32_t size)
+	{
+		if (!s_RenderThread || s_RenderThread->IsCurrentThread())
+			return data;
+
+		void* copy = s_RenderThread->GetRecordQueue().AllocateData(size);
+		memcpy(copy, data, size);
+		return copy;
+	}
 
-}
\ No newline at end of file
+}
@@ -1,39 +1,140 @@
 #pragma once
 
 #include "RendererAPI.h"
+#include "RenderThread.h"
 
 namespace Hazel {
 
 	class HAZEL_API RenderCommand
 	{
 	public:
+		// Creates the backend for RendererAPI::GetAPI()
 		inline static void Init()
 		{
-			s_RendererAPI->Init();
+			SubmitAndWait([]()
+			{
+				delete s_RendererAPI;
+				s_RendererAPI = RendererAPI::Create();
+				s_RendererAPI->Init();
+			});
+		}
+
+		// Moves command execution and the context onto a render thread, which may lag framesInFlight
+		// frames behind the caller. Must be called before Renderer::Init.
+		static void StartRenderThread(GraphicsContext* context, uint32_t framesInFlight);
+		// Executes every pending command and hands the context back to the calling thread
+		static void StopRenderThread();
+
+		inline static bool IsThreaded() { return s_RenderThread != nullptr; }
+
+		// Hands the recorded frame over to the render thread, no-op without one
+		static void EndFrame();
+
+		// Records func for the render thread, or runs it right away when there is none. Captured
+		// state must stay valid until the frame has executed, so capture by value.
+		template<typename FuncT>
+		static void Submit(FuncT&& func)
+		{
+			if (!s_RenderThread || s_RenderThread->IsCurrentThread())
+				func();
+			else
+				s_RenderThread->GetRecordQueue().Submit(std::forward<FuncT>(func));
+		}
+
+		// Runs func on the render thread and waits for it, for work whose result is needed now
+		static void SubmitAndWait(const std::function<void()>& func);
+
+		// Copies data into the frame being recorded so a submitted command can read it later.
+		// Returns data itself when commands execute immediately.
+		static const void* CopyData(const void* data, uint32_t size);
+
+		// Set by Init, so it can be read from any thread afterwards
+		inline static uint32_t GetMaxTextureSlots()
+		{
+			return s_RendererAPI->GetMaxTextureSlots();
+		}
+
+		// Summed over the frames executed since the last reset
+		inline static BindStatistics GetBindStats()
+		{
+			return s_RendererAPI->GetBindStats();
+		}
+
+		inline static void ResetBindStats()
+		{
+			s_RendererAPI->ResetBindStats();
 		}
 
 		inline static void SetClearColor(const glm::vec4& color)
 		{
-			s_RendererAPI->SetClearColor(color);
+			Submit([color]() { s_RendererAPI->SetClearColor(color); });
 		}
 
 		inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 		{
-			s_RendererAPI->SetViewport(x, y, width, height);
+			Submit([x, y, width, height]() { s_RendererAPI->SetViewport(x, y, width, height); });
 		}
 
 		inline static void Clear()
 		{
-			s_RendererAPI->Clear();
+			Submit([]() { s_RendererAPI->Clear(); });
+		}
+
+		inline static void DrawIndexed(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t indexCount = 0,
+			uint32_t baseVertex = 0,
+			uint32_t firstIndex = 0
+		)
+		{
+			Submit([vertexArray, indexCount, baseVertex, firstIndex]()
+			{
+				s_RendererAPI->DrawIndexed(vertexArray, indexCount, baseVertex, firstIndex);
+			});
+		}
+
+		inline static void DrawArraysInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t vertexCount,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0
+		)
+		{
+			Submit([vertexArray, vertexCount, instanceCount, baseInstance]()
+			{
+				s_RendererAPI->DrawArraysInstanced(vertexArray, vertexCount, instanceCount, baseInstance);
+			});
+		}
+
+		inline static void DrawIndexedInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0,
+			uint32_t indexCount = 0
+		)
+		{
+			Submit([vertexArray, instanceCount, baseInstance, indexCount]()
+			{
+				s_RendererAPI->DrawIndexedInstanced(vertexArray, instanceCount, baseInstance, indexCount);
+			});
 		}
 
-		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0)
+		inline static void DrawIndexedIndirect(
+			const Ref<VertexArray>& vertexArray,
+			const DrawIndexedIndirectCommand* commands,
+			uint32_t count
+		)
 		{
-			s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+			commands = (const DrawIndexedIndirectCommand*)CopyData(commands, count * sizeof(DrawIndexedIndirectCommand));
+			Submit([vertexArray, commands, count]()
+			{
+				s_RendererAPI->DrawIndexedIndirect(vertexArray, commands, count);
+			});
 		}
 
 	private:
 		static RendererAPI* s_RendererAPI;
+		static std::unique_ptr<RenderThread> s_RenderThread;
 	};
 
 }
@@ -0,0 +1,80 @@
+#include "hzpch.h"
+#include "RenderCommandQueue.h"
+
+namespace Hazel {
+
+	static uint32_t AlignUp(uint32_t value, uint32_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		Clear();
+	}
+
+	void* RenderCommandQueue::AllocateData(uint32_t size)
+	{
+		return Allocate(nullptr, size);
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		HZ_PROFILE_FUNCTION()
+		Drain(true);
+	}
+
+	void RenderCommandQueue::Clear()
+	{
+		Drain(false);
+	}
+
+	void* RenderCommandQueue::Allocate(CommandFn function, uint32_t size)
+	{
+		uint32_t headerSize = AlignUp(sizeof(CommandHeader), s_Alignment);
+		uint32_t recordSize = headerSize + AlignUp(size, s_Alignment);
+
+		// Move on to the next block that fits, a record larger than a block gets its own
+		while (m_CurrentBlock < m_Blocks.size()
+			&& m_Blocks[m_CurrentBlock].Size + recordSize > m_Blocks[m_CurrentBlock].Capacity)
+		{
+			m_CurrentBlock++;
+		}
+		if (m_CurrentBlock == m_Blocks.size())
+		{
+			uint32_t capacity = std::max(recordSize, s_BlockSize);
+			m_Blocks.push_back({ std::unique_ptr<uint8_t[]>(new uint8_t[capacity]), capacity, 0 });
+		}
+
+		Block& block = m_Blocks[m_CurrentBlock];
+		uint8_t* record = block.Data.get() + block.Size;
+		block.Size += recordSize;
+
+		new (record) CommandHeader{ function, size };
+		if (function)
+			m_CommandCount++;
+
+		return record + headerSize;
+	}
+
+	void RenderCommandQueue::Drain(bool execute)
+	{
+		uint32_t headerSize = AlignUp(sizeof(CommandHeader), s_Alignment);
+		for (Block& block : m_Blocks)
+		{
+			uint32_t offset = 0;
+			while (offset < block.Size)
+			{
+				CommandHeader* header = (CommandHeader*)(block.Data.get() + offset);
+				if (header->Function)
+					header->Function(block.Data.get() + offset + headerSize, execute);
+				offset += headerSize + AlignUp(header->Size, s_Alignment);
+			}
+			block.Size = 0;
+		}
+
+		m_CurrentBlock = 0;
+		m_CommandCount = 0;
+	}
+
+}
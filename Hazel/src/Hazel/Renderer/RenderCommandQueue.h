@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+namespace Hazel {
+
+	// Linear buffer of recorded commands. Each command is stored inline as a function pointer
+	// followed by the callable, so recording a frame allocates nothing once the blocks have grown
+	// to fit it. Blocks never move, callables do not need to be relocatable.
+	class HAZEL_API RenderCommandQueue
+	{
+	public:
+		RenderCommandQueue() = default;
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template<typename FuncT>
+		void Submit(FuncT&& func)
+		{
+			using Func = std::decay_t<FuncT>;
+			static_assert(alignof(Func) <= s_Alignment, "Command is over-aligned!");
+
+			// Runs the callable unless the queue is cleared without executing, destroys it either way
+			CommandFn command = [](void* payload, bool execute)
+			{
+				Func* func = (Func*)payload;
+				if (execute)
+					(*func)();
+				func->~Func();
+			};
+			new (Allocate(command, sizeof(Func))) Func(std::forward<FuncT>(func));
+		}
+
+		// Storage for data a command reads, lives until the queue has been executed
+		void* AllocateData(uint32_t size);
+
+		// Runs the commands in submission order and empties the queue
+		void Execute();
+		// Empties the queue without running the commands
+		void Clear();
+
+		inline uint32_t GetCommandCount() const { return m_CommandCount; }
+
+	private:
+		typedef void(*CommandFn)(void* payload, bool execute);
+
+		struct CommandHeader
+		{
+			CommandFn Function; // Null for data allocations
+			uint32_t Size;      // Payload bytes, header and padding excluded
+		};
+
+		struct Block
+		{
+			std::unique_ptr<uint8_t[]> Data;
+			uint32_t Capacity;
+			uint32_t Size;
+		};
+
+		void* Allocate(CommandFn function, uint32_t size);
+		void Drain(bool execute);
+
+	private:
+		static const uint32_t s_Alignment = 16;
+		static const uint32_t s_BlockSize = 1024 * 1024;
+
+		std::vector<Block> m_Blocks;
+		uint32_t m_CurrentBlock = 0;
+		uint32_t m_CommandCount = 0;
+	};
+
+}
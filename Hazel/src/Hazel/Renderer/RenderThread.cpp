@@ -0,0 +1,114 @@
+#include "hzpch.h"
+#include "RenderThread.h"
+
+namespace Hazel {
+
+	RenderThread::RenderThread(GraphicsContext* context, uint32_t framesInFlight)
+		: m_Context(context)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(framesInFlight > 0, "At least one frame must be in flight!")
+
+		for (uint32_t i = 0; i < framesInFlight + 1; i++)
+			m_Queues.push_back(std::make_unique<RenderCommandQueue>());
+
+		// A context can only be current on one thread
+		m_Context->ReleaseCurrent();
+		m_Thread = std::thread(&RenderThread::Run, this);
+	}
+
+	RenderThread::~RenderThread()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		{
+			std::unique_lock lock(m_Mutex);
+			HandOver(lock);
+			m_Quit = true;
+			m_WakeCondition.notify_one();
+		}
+		m_Thread.join();
+
+		m_Context->MakeCurrent();
+	}
+
+	void RenderThread::EndFrame()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		std::unique_lock lock(m_Mutex);
+		HandOver(lock);
+	}
+
+	void RenderThread::Flush()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		std::unique_lock lock(m_Mutex);
+		HandOver(lock);
+		m_DoneCondition.wait(lock, [this] { return m_PendingCount == 0; });
+	}
+
+	void RenderThread::ExecuteAndWait(const std::function<void()>& func)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		std::unique_lock lock(m_Mutex);
+		m_Job = &func;
+		m_WakeCondition.notify_one();
+		m_DoneCondition.wait(lock, [this] { return m_Job == nullptr; });
+	}
+
+	void RenderThread::HandOver(std::unique_lock<std::mutex>& lock)
+	{
+		// The queue recorded next must not be pending anymore, which caps the pending frames at
+		// framesInFlight once this one is handed over
+		m_DoneCondition.wait(lock, [this] { return m_PendingCount < GetFramesInFlight(); });
+
+		m_PendingCount++;
+		m_RecordIndex = (m_RecordIndex + 1) % (uint32_t)m_Queues.size();
+		m_WakeCondition.notify_one();
+	}
+
+	void RenderThread::Run()
+	{
+		m_Context->MakeCurrent();
+
+		std::unique_lock lock(m_Mutex);
+		while (true)
+		{
+			m_WakeCondition.wait(lock, [this] { return m_Job || m_PendingCount || m_Quit; });
+
+			if (m_Job)
+			{
+				lock.unlock();
+				(*m_Job)();
+				lock.lock();
+
+				m_Job = nullptr;
+				m_DoneCondition.notify_all();
+			}
+			else if (m_PendingCount)
+			{
+				RenderCommandQueue& queue = *m_Queues[m_ExecuteIndex];
+				lock.unlock();
+				{
+					HZ_PROFILE_SCOPE("RenderThread Frame")
+					queue.Execute();
+				}
+				lock.lock();
+
+				m_ExecuteIndex = (m_ExecuteIndex + 1) % (uint32_t)m_Queues.size();
+				m_PendingCount--;
+				m_DoneCondition.notify_all();
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		m_Context->ReleaseCurrent();
+	}
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Hazel/Renderer/GraphicsContext.h"
+#include "Hazel/Renderer/RenderCommandQueue.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Hazel {
+
+	// Owns the graphics context and executes recorded frames in order while the caller records the
+	// next one. framesInFlight limits how many handed over frames may still be waiting or executing.
+	class HAZEL_API RenderThread
+	{
+	public:
+		// Takes the context over from the calling thread
+		RenderThread(GraphicsContext* context, uint32_t framesInFlight);
+		// Executes every recorded command, then hands the context back to the calling thread
+		~RenderThread();
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+
+		inline RenderCommandQueue& GetRecordQueue() { return *m_Queues[m_RecordIndex]; }
+		inline bool IsCurrentThread() const { return std::this_thread::get_id() == m_Thread.get_id(); }
+		inline uint32_t GetFramesInFlight() const { return (uint32_t)m_Queues.size() - 1; }
+
+		// Hands the recorded commands over, blocks while framesInFlight frames are still pending
+		void EndFrame();
+		// Hands the recorded commands over and blocks until the render thread is idle
+		void Flush();
+
+		// Runs func on the render thread between two frames and waits for it. It may run ahead of
+		// frames that are still pending, so it must not depend on their commands.
+		void ExecuteAndWait(const std::function<void()>& func);
+
+	private:
+		void Run();
+		void HandOver(std::unique_lock<std::mutex>& lock);
+
+	private:
+		GraphicsContext* m_Context;
+		std::thread m_Thread;
+
+		// One being recorded, the others pending in submission order
+		std::vector<std::unique_ptr<RenderCommandQueue>> m_Queues;
+		uint32_t m_RecordIndex = 0;
+		uint32_t m_ExecuteIndex = 0;
+		uint32_t m_PendingCount = 0;
+
+		const std::function<void()>* m_Job = nullptr;
+		bool m_Quit = false;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_WakeCondition;
+		std::condition_variable m_DoneCondition;
+	};
+
+}
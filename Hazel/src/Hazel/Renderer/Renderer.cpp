@@ -3,7 +3,7 @@
 
 #include "Hazel/Renderer/Renderer2D.h"
 
-#include "Platform/OpenGL/OpenGLShader.h"
+#include <tuple>
 
 namespace Hazel {
 
@@ -13,29 +13,370 @@ namespace Hazel {
 	{
 		RenderCommand::Init();
 		Renderer2D::Init();
+
+		// Each draw gets its own SceneData slice, so consecutive draws never wait on each other's upload
+		m_SceneData->DrawUniformBuffer = UniformBuffer::Create(SceneData::DrawUniformBufferSize);
+		uint32_t alignment = m_SceneData->DrawUniformBuffer->GetOffsetAlignment();
+		m_SceneData->DrawStride = (sizeof(DrawUniforms) + alignment - 1) / alignment * alignment;
+
+		BufferLayout instanceLayout({ { ShaderDataType::Mat4, "a_Transform" } }, true /* instanced */);
+		instanceLayout.begin()->Location = InstanceTransformLocation;
+		m_SceneData->InstanceBuffer = VertexBuffer::Create(SceneData::MaxInstances * sizeof(glm::mat4));
+		m_SceneData->InstanceBuffer->SetLayout(instanceLayout);
+
+		m_SceneData->Materials.assign(1, nullptr);
+	}
+
+	// Opaque:      pass (4) | shader (12) | material (16) | vertex array (12) | depth (20), front to back
+	// Transparent: pass (4) | depth (20) | shader (12) | material (16) | vertex array (12), back to front
+	static const uint32_t ShaderBits = 12, MaterialBits = 16, VertexArrayBits = 12, DepthBits = 20;
+	static const uint32_t StateBits = ShaderBits + MaterialBits + VertexArrayBits;
+	static const uint64_t StateMask = (1ull << StateBits) - 1;
+	static const uint32_t DepthMask = (1u << DepthBits) - 1;
+	static const uint64_t TransparentPass = 1ull << (StateBits + DepthBits);
+
+	static uint64_t MakeSortKey(bool transparent, uint32_t shader, uint32_t material, uint32_t vertexArray, uint32_t depth)
+	{
+		uint64_t state = ((uint64_t)shader << (MaterialBits + VertexArrayBits)) | ((uint64_t)material << VertexArrayBits) | vertexArray;
+		if (transparent)
+			return TransparentPass | ((uint64_t)(DepthMask - depth) << StateBits) | state;
+		return (state << DepthBits) | depth;
+	}
+
+	// The shader, material and vertex array part of a key
+	static uint64_t GetState(uint64_t key)
+	{
+		return key >= TransparentPass ? key & StateMask : (key >> DepthBits) & StateMask;
+	}
+
+	static uint32_t GetShaderIndex(uint64_t state) { return (uint32_t)(state >> (MaterialBits + VertexArrayBits)); }
+	static uint32_t GetMaterialIndex(uint64_t state) { return (uint32_t)(state >> VertexArrayBits) & ((1u << MaterialBits) - 1); }
+	static uint32_t GetVertexArrayIndex(uint64_t state) { return (uint32_t)state & ((1u << VertexArrayBits) - 1); }
+
+	// Depth of the transform's origin in normalized device coordinates, quantized to DepthBits
+	static uint32_t QuantizeDepth(const glm::mat4& viewProjection, const glm::mat4& transform)
+	{
+		glm::vec4 clip = viewProjection * transform[3];
+		float depth = clip.w != 0.0f ? clip.z / clip.w : 0.0f;
+		depth = glm::clamp(depth * 0.5f + 0.5f, 0.0f, 1.0f);
+		return (uint32_t)(depth * DepthMask);
+	}
+
+	template<typename T>
+	static uint32_t GetTableIndex(std::vector<Ref<T>>& table, std::unordered_map<const void*, uint32_t>& indices, const Ref<T>& item)
+	{
+		auto [it, inserted] = indices.try_emplace(item.get(), (uint32_t)table.size());
+		if (inserted)
+			table.push_back(item);
+		return it->second;
+	}
+
+	// Shader, material and vertex array switches when the draws execute in their current order
+	template<typename T>
+	static uint32_t CountStateChanges(const std::vector<T>& draws)
+	{
+		uint32_t changes = 0;
+		uint64_t previous = ~0ull;
+		for (const auto& draw : draws)
+		{
+			uint64_t state = GetState(draw.Key);
+			if (previous != ~0ull)
+			{
+				changes += GetShaderIndex(state) != GetShaderIndex(previous);
+				changes += GetMaterialIndex(state) != GetMaterialIndex(previous);
+				changes += GetVertexArrayIndex(state) != GetVertexArrayIndex(previous);
+			}
+			else
+			{
+				changes += 3;
+			}
+			previous = state;
+		}
+		return changes;
 	}
 
 	void Renderer::BeginScene(OrthographicCamera& camera)
 	{
+		HZ_CORE_ASSERT(m_SceneData->Draws.empty(), "BeginScene without EndScene!")
 		m_SceneData->ViewProjectionMatrix = camera.GetViewProjectionMatrix();
 	}
 
-	void Renderer::EndScene() {}
+	void Renderer::EndScene()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		auto& draws = m_SceneData->Draws;
+		uint32_t unsortedChanges = CountStateChanges(draws);
+
+		std::sort(draws.begin(), draws.end(), [](const QueuedDraw& a, const QueuedDraw& b)
+		{
+			return a.Key != b.Key ? a.Key < b.Key : a.Index < b.Index;
+		});
+		uint32_t sortedChanges = CountStateChanges(draws);
+		m_SceneData->Stats.StateChangesSaved += (int32_t)unsortedChanges - (int32_t)sortedChanges;
+
+		uint64_t boundState = ~0ull;
+		const VertexArray* boundVertexArray = nullptr;
+		for (size_t begin = 0; begin < draws.size();)
+		{
+			// Run of draws with the same state
+			uint64_t state = GetState(draws[begin].Key);
+			size_t end = begin + 1;
+			while (end < draws.size() && GetState(draws[end].Key) == state)
+				end++;
+
+			const Ref<Shader>& shader = m_SceneData->Shaders[GetShaderIndex(state)];
+			auto instanceInput = shader->GetReflection().FindInput("a_Transform");
+			const Ref<VertexArray>& vertexArray = instanceInput
+				? GetInstancedVertexArray(m_SceneData->VertexArrays[GetVertexArrayIndex(state)])
+				: m_SceneData->VertexArrays[GetVertexArrayIndex(state)];
+			if (boundState == ~0ull || GetShaderIndex(state) != GetShaderIndex(boundState))
+			{
+				shader->Bind();
+				m_SceneData->Stats.ShaderBinds++;
+			}
+			if (boundState == ~0ull || GetMaterialIndex(state) != GetMaterialIndex(boundState))
+			{
+				if (const Ref<Material>& material = m_SceneData->Materials[GetMaterialIndex(state)])
+					material->Bind();
+				m_SceneData->Stats.MaterialBinds++;
+			}
+			if (vertexArray.get() != boundVertexArray)
+			{
+				vertexArray->Bind();
+				m_SceneData->Stats.VertexArrayBinds++;
+				boundVertexArray = vertexArray.get();
+			}
+			boundState = state;
+
+			if (instanceInput)
+			{
+				HZ_CORE_ASSERT(instanceInput->Location == InstanceTransformLocation, "a_Transform is not at InstanceTransformLocation!")
+
+				auto& runDraws = m_SceneData->RunDraws;
+				runDraws.clear();
+				for (size_t i = begin; i < end; i++)
+					runDraws.push_back(draws[i].Index);
+
+				// Instances of the same range have to be next to each other in the instance buffer.
+				// Transparent runs stay in key order, which is back to front.
+				if (draws[begin].Key < TransparentPass)
+				{
+					std::stable_sort(runDraws.begin(), runDraws.end(), [](uint32_t a, uint32_t b)
+					{
+						const IndexRange& rangeA = m_SceneData->Ranges[a];
+						const IndexRange& rangeB = m_SceneData->Ranges[b];
+						return std::tie(rangeA.FirstIndex, rangeA.BaseVertex, rangeA.Count)
+							< std::tie(rangeB.FirstIndex, rangeB.BaseVertex, rangeB.Count);
+					});
+				}
+				DrawInstances(vertexArray, runDraws.data(), (uint32_t)runDraws.size());
+			}
+			else
+			{
+				for (size_t i = begin; i < end; i++)
+				{
+					const IndexRange& range = m_SceneData->Ranges[draws[i].Index];
+					UploadDrawUniforms(m_SceneData->Transforms[draws[i].Index]);
+					RenderCommand::DrawIndexed(vertexArray, range.Count, range.BaseVertex, range.FirstIndex);
+					m_SceneData->Stats.DrawCalls++;
+				}
+			}
+
+			begin = end;
+		}
+
+		draws.clear();
+		m_SceneData->Transforms.clear();
+		m_SceneData->Ranges.clear();
+		m_SceneData->Shaders.clear();
+		m_SceneData->Materials.assign(1, nullptr);
+		m_SceneData->VertexArrays.clear();
+		m_SceneData->TableIndices.clear();
+
+		// Drop the instanced copies of vertex arrays that were destroyed
+		auto& instancedVertexArrays = m_SceneData->InstancedVertexArrays;
+		for (auto it = instancedVertexArrays.begin(); it != instancedVertexArrays.end();)
+		{
+			if (it->second.Source.expired())
+				it = instancedVertexArrays.erase(it);
+			else
+				++it;
+		}
+	}
 
 	void Renderer::Submit(
 		const Ref<Shader>& shader,
 		const Ref<VertexArray>& vertexArray,
-		const glm::mat4& transform
+		const glm::mat4& transform,
+		const IndexRange& range
 	)
 	{
-		auto glShader = std::dynamic_pointer_cast<OpenGLShader>(shader);
+		Enqueue(shader, nullptr, vertexArray, &transform, 1, range);
+	}
 
-		glShader->Bind();
-		glShader->UploadUniformMat4("u_SceneData.ViewProjection", m_SceneData->ViewProjectionMatrix);
-		glShader->UploadUniformMat4("u_SceneData.Transform", transform);
+	void Renderer::Submit(
+		const Ref<Material>& material,
+		const Ref<VertexArray>& vertexArray,
+		const glm::mat4& transform,
+		const IndexRange& range
+	)
+	{
+		Enqueue(material->GetShader(), material, vertexArray, &transform, 1, range);
+	}
 
-		vertexArray->Bind();
-		RenderCommand::DrawIndexed(vertexArray);
+	void Renderer::SubmitInstanced(
+		const Ref<Shader>& shader,
+		const Ref<VertexArray>& vertexArray,
+		const glm::mat4* transforms,
+		uint32_t count,
+		const IndexRange& range
+	)
+	{
+		Enqueue(shader, nullptr, vertexArray, transforms, count, range);
+	}
+
+	void Renderer::SubmitInstanced(
+		const Ref<Material>& material,
+		const Ref<VertexArray>& vertexArray,
+		const glm::mat4* transforms,
+		uint32_t count,
+		const IndexRange& range
+	)
+	{
+		Enqueue(material->GetShader(), material, vertexArray, transforms, count, range);
+	}
+
+	void Renderer::Enqueue(
+		const Ref<Shader>& shader,
+		const Ref<Material>& material,
+		const Ref<VertexArray>& vertexArray,
+		const glm::mat4* transforms,
+		uint32_t count,
+		const IndexRange& range
+	)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		auto& indices = m_SceneData->TableIndices;
+		uint32_t shaderIndex = GetTableIndex(m_SceneData->Shaders, indices, shader);
+		uint32_t materialIndex = material ? GetTableIndex(m_SceneData->Materials, indices, material) : 0;
+		uint32_t vertexArrayIndex = GetTableIndex(m_SceneData->VertexArrays, indices, vertexArray);
+		HZ_CORE_ASSERT(
+			shaderIndex < (1u << ShaderBits) && materialIndex < (1u << MaterialBits) && vertexArrayIndex < (1u << VertexArrayBits),
+			"Too many shaders, materials or vertex arrays in one scene!"
+		)
+
+		// Resolved here so equal ranges compare equal when the draws are grouped
+		IndexRange resolvedRange = range;
+		uint32_t indexCount = vertexArray->GetIndexBuffer()->GetCount();
+		if (resolvedRange.Count == 0)
+			resolvedRange.Count = range.FirstIndex < indexCount ? indexCount - range.FirstIndex : 0;
+		HZ_CORE_ASSERT(range.FirstIndex + resolvedRange.Count <= indexCount, "Index range is outside the index buffer!")
+
+		bool transparent = material && material->IsTransparent();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t depth = QuantizeDepth(m_SceneData->ViewProjectionMatrix, transforms[i]);
+			m_SceneData->Draws.push_back({
+				MakeSortKey(transparent, shaderIndex, materialIndex, vertexArrayIndex, depth),
+				(uint32_t)m_SceneData->Transforms.size()
+			});
+			m_SceneData->Transforms.push_back(transforms[i]);
+			m_SceneData->Ranges.push_back(resolvedRange);
+		}
+		m_SceneData->Stats.MeshCount += count;
+	}
+
+	const Ref<VertexArray>& Renderer::GetInstancedVertexArray(const Ref<VertexArray>& vertexArray)
+	{
+		InstancedVertexArray& instanced = m_SceneData->InstancedVertexArrays[vertexArray.get()];
+
+		// A new vertex array can reuse the address of a destroyed one
+		const auto& vertexBuffers = vertexArray->GetVertexBuffers();
+		if (instanced.Source.lock() != vertexArray
+			|| instanced.SourceVertexBufferCount != vertexBuffers.size()
+			|| instanced.SourceIndexBuffer != vertexArray->GetIndexBuffer())
+		{
+			HZ_CORE_ASSERT(
+				std::find(vertexBuffers.begin(), vertexBuffers.end(), m_SceneData->InstanceBuffer) == vertexBuffers.end(),
+				"The instance buffer is added by the renderer!"
+			)
+
+			instanced.Source = vertexArray;
+			instanced.Instanced = VertexArray::Create();
+			for (const auto& vertexBuffer : vertexBuffers)
+				instanced.Instanced->AddVertexBuffer(vertexBuffer);
+			instanced.Instanced->AddVertexBuffer(m_SceneData->InstanceBuffer);
+			instanced.Instanced->SetIndexBuffer(vertexArray->GetIndexBuffer());
+			instanced.SourceVertexBufferCount = vertexBuffers.size();
+			instanced.SourceIndexBuffer = vertexArray->GetIndexBuffer();
+		}
+
+		return instanced.Instanced;
+	}
+
+	void Renderer::DrawInstances(const Ref<VertexArray>& vertexArray, const uint32_t* draws, uint32_t count)
+	{
+		// SceneData still carries the camera
+		UploadDrawUniforms(glm::mat4(1.0f));
+
+		auto& transforms = m_SceneData->InstanceTransforms;
+		auto& commands = m_SceneData->IndirectCommands;
+		while (count > 0)
+		{
+			uint32_t instanceCount = std::min(count, SceneData::MaxInstances);
+
+			// Wrap around once the ring is full
+			if (m_SceneData->InstanceOffset + instanceCount > SceneData::MaxInstances)
+				m_SceneData->InstanceOffset = 0;
+
+			// One command per range, its instances start at BaseInstance
+			transforms.clear();
+			commands.clear();
+			for (uint32_t i = 0; i < instanceCount; i++)
+			{
+				const IndexRange& range = m_SceneData->Ranges[draws[i]];
+				if (i == 0 || !(range == m_SceneData->Ranges[draws[i - 1]]))
+					commands.push_back({ range.Count, 0, range.FirstIndex, (int32_t)range.BaseVertex, m_SceneData->InstanceOffset + i });
+				commands.back().InstanceCount++;
+				transforms.push_back(m_SceneData->Transforms[draws[i]]);
+			}
+
+			m_SceneData->InstanceBuffer->SetData(
+				transforms.data(),
+				instanceCount * sizeof(glm::mat4),
+				m_SceneData->InstanceOffset * sizeof(glm::mat4)
+			);
+
+			const DrawIndexedIndirectCommand& command = commands.front();
+			if (commands.size() == 1 && command.FirstIndex == 0 && command.BaseVertex == 0)
+			{
+				RenderCommand::DrawIndexedInstanced(vertexArray, instanceCount, command.BaseInstance, command.Count);
+			}
+			else
+			{
+				RenderCommand::DrawIndexedIndirect(vertexArray, commands.data(), (uint32_t)commands.size());
+				m_SceneData->Stats.IndirectCommands += (uint32_t)commands.size();
+			}
+
+			m_SceneData->InstanceOffset += instanceCount;
+			m_SceneData->Stats.DrawCalls++;
+			draws += instanceCount;
+			count -= instanceCount;
+		}
+	}
+
+	void Renderer::UploadDrawUniforms(const glm::mat4& transform)
+	{
+		DrawUniforms uniforms = { m_SceneData->ViewProjectionMatrix, transform };
+
+		// Wrap around once the ring is full
+		if (m_SceneData->DrawOffset + m_SceneData->DrawStride > m_SceneData->DrawUniformBuffer->GetSize())
+			m_SceneData->DrawOffset = 0;
+		m_SceneData->DrawUniformBuffer->SetData(&uniforms, sizeof(DrawUniforms), m_SceneData->DrawOffset);
+		m_SceneData->DrawUniformBuffer->BindRange(0, m_SceneData->DrawOffset, sizeof(DrawUniforms));
+		m_SceneData->DrawOffset += m_SceneData->DrawStride;
 	}
 
 	void Renderer::OnWindowResize(uint32_t width, uint32_t height)
@@ -43,4 +384,14 @@ namespace Hazel {
 		RenderCommand::SetViewport(0, 0, width, height);
 	}
 
+	Renderer::Statistics Renderer::GetStats()
+	{
+		return m_SceneData->Stats;
+	}
+
+	void Renderer::ResetStats()
+	{
+		m_SceneData->Stats = Statistics();
+	}
+
 }
\ No newline at end of file
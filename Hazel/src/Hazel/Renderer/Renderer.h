@@ -1,11 +1,29 @@
 #pragma once
 
 #include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/Material.h"
 #include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/UniformBuffer.h"
 #include "Hazel/Camera/OrthographicCamera.h"
 
 namespace Hazel {
 
+	// Part of a vertex array's index buffer, so several meshes can share one vertex array
+	struct IndexRange
+	{
+		uint32_t Count = 0; // 0 = the whole index buffer
+		uint32_t FirstIndex = 0;
+		uint32_t BaseVertex = 0;
+
+		bool operator==(const IndexRange& other) const
+		{
+			return Count == other.Count && FirstIndex == other.FirstIndex && BaseVertex == other.BaseVertex;
+		}
+	};
+
+	// Submits between BeginScene and EndScene are queued and drawn at EndScene, sorted by pass,
+	// shader, material, vertex array and depth so state changes are kept to a minimum. Textures and
+	// uniform buffers a draw needs have to come with its material, see Material.
 	class HAZEL_API Renderer
 	{
 	public:
@@ -17,20 +35,131 @@ namespace Hazel {
 		static void Submit(
 			const Ref<Shader>& shader,
 			const Ref<VertexArray>& vertexArray,
-			const glm::mat4& transform = glm::mat4(1.0f)
+			const glm::mat4& transform = glm::mat4(1.0f),
+			const IndexRange& range = {}
+		);
+		static void Submit(
+			const Ref<Material>& material,
+			const Ref<VertexArray>& vertexArray,
+			const glm::mat4& transform = glm::mat4(1.0f),
+			const IndexRange& range = {}
+		);
+
+		// Draws vertexArray once per transform. Draws that end up next to each other in the queue
+		// with the same state become a single instanced draw when the shader reads the transform
+		// from a per instance mat4 a_Transform input at InstanceTransformLocation, so this is the
+		// same as submitting every transform on its own. Different index ranges of the vertex
+		// array are drawn with one multi-draw.
+		static void SubmitInstanced(
+			const Ref<Shader>& shader,
+			const Ref<VertexArray>& vertexArray,
+			const glm::mat4* transforms,
+			uint32_t count,
+			const IndexRange& range = {}
+		);
+		static void SubmitInstanced(
+			const Ref<Material>& material,
+			const Ref<VertexArray>& vertexArray,
+			const glm::mat4* transforms,
+			uint32_t count,
+			const IndexRange& range = {}
 		);
 
 		static void OnWindowResize(uint32_t width, uint32_t height);
 
 		inline static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
 
+		// The instance transform takes this and the next three locations, GL guarantees 16
+		static const uint32_t InstanceTransformLocation = 12;
+
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t MeshCount = 0;
+			uint32_t ShaderBinds = 0;
+			uint32_t MaterialBinds = 0;
+			uint32_t VertexArrayBinds = 0;
+			uint32_t IndirectCommands = 0; // Draws issued through multi-draws
+			int32_t StateChangesSaved = 0; // Compared to submission order, back to front sorting can cost some
+		};
+
+		static Statistics GetStats();
+		static void ResetStats();
+
 	private:
+		static void Enqueue(
+			const Ref<Shader>& shader,
+			const Ref<Material>& material,
+			const Ref<VertexArray>& vertexArray,
+			const glm::mat4* transforms,
+			uint32_t count,
+			const IndexRange& range
+		);
+		static void UploadDrawUniforms(const glm::mat4& transform);
+		// The submitted vertex array's buffers plus InstanceBuffer, the submitted one is left as is
+		static const Ref<VertexArray>& GetInstancedVertexArray(const Ref<VertexArray>& vertexArray);
+		// Expects the shader and the instanced vertex array to be bound, and the draws to be grouped by range
+		static void DrawInstances(const Ref<VertexArray>& vertexArray, const uint32_t* draws, uint32_t count);
+
+	private:
+		// Layout of the SceneData block in the engine's 3D shaders
+		struct DrawUniforms
+		{
+			glm::mat4 ViewProjection;
+			glm::mat4 Transform;
+		};
+
+		// Sorted at EndScene. The key holds the indices of the draw's shader, material and vertex
+		// array in the scene's tables, see MakeSortKey.
+		struct QueuedDraw
+		{
+			uint64_t Key;
+			uint32_t Index; // Into Transforms and Ranges, also the submission order which breaks ties
+		};
+
+		struct InstancedVertexArray
+		{
+			std::weak_ptr<VertexArray> Source;
+			Ref<VertexArray> Instanced;
+			// What the source had when Instanced was built, buffers are only ever added
+			size_t SourceVertexBufferCount = 0;
+			Ref<IndexBuffer> SourceIndexBuffer;
+		};
+
 		struct SceneData
 		{
+			static const uint32_t DrawUniformBufferSize = 64 * 1024;
+			static const uint32_t MaxInstances = 1024; // Per draw, 64 KB of transforms
+
 			glm::mat4 ViewProjectionMatrix;
+
+			Ref<UniformBuffer> DrawUniformBuffer;
+			uint32_t DrawStride = 0;
+			uint32_t DrawOffset = 0;
+
+			// Ring of instance transforms, bound through a renderer owned copy of each instanced vertex array
+			Ref<VertexBuffer> InstanceBuffer;
+			uint32_t InstanceOffset = 0; // In instances
+			std::unordered_map<const VertexArray*, InstancedVertexArray> InstancedVertexArrays;
+
+			// Render queue of the current scene
+			std::vector<QueuedDraw> Draws;
+			std::vector<glm::mat4> Transforms;
+			std::vector<IndexRange> Ranges;
+			std::vector<Ref<Shader>> Shaders;
+			std::vector<Ref<Material>> Materials; // 0 = no material
+			std::vector<Ref<VertexArray>> VertexArrays;
+			std::unordered_map<const void*, uint32_t> TableIndices;
+
+			// Scratch for instanced runs
+			std::vector<uint32_t> RunDraws;
+			std::vector<glm::mat4> InstanceTransforms;
+			std::vector<DrawIndexedIndirectCommand> IndirectCommands;
+
+			Statistics Stats;
 		};
 
 		static SceneData* m_SceneData;
 	};
 
-}
\ No newline at end of file
+}
@@ -3,9 +3,15 @@
 
 #include "Hazel/Renderer/VertexArray.h"
 #include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/ShaderLibrary.h"
 #include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/UniformBuffer.h"
+#include "Hazel/Renderer/StorageBuffer.h"
 
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include <xmmintrin.h>
 
 namespace Hazel {
 
@@ -17,115 +23,365 @@ namespace Hazel {
 		float     TexIndex;
 		float	  TilingFactor;
 	};
+
+	// 24 byte alternative to QuadVertex (see Renderer2DSettings::PackedVertices)
+	struct PackedQuadVertex
+	{
+		glm::vec3 Position;
+		uint32_t  Color;           // RGBA8, normalized
+		uint16_t  TexCoord[2];     // normalized
+		uint32_t  TexIndexTiling;  // bits 0-7: texture index, bits 16-31: tiling factor as half float
+	};
+
+	// One record per quad, expanded to corners in the vertex shader (see Renderer2DSettings::Instanced)
+	struct QuadInstance
+	{
+		glm::vec3 Center;
+		float     Rotation;
+		glm::vec2 Size;
+		uint32_t  Color;           // RGBA8, normalized
+		uint16_t  TexCoordMin[2];  // normalized
+		uint16_t  TexCoordMax[2];  // normalized
+		uint32_t  TexIndexTiling;  // same packing as PackedQuadVertex
+	};
 	
+	// Quad recorded in sorted mode, emitted at EndScene
+	struct SortedQuad
+	{
+		glm::vec3 Positions[4];
+		glm::vec4 Color;
+		glm::vec2 TexCoords[4];
+		float     TilingFactor;
+		uint32_t  TextureHandle;
+	};
+
+	struct QuadSortKey
+	{
+		uint64_t Key;
+		uint32_t Index; // into Renderer2DData::SortedQuads
+	};
+
 	struct Renderer2DData
 	{
 		const uint32_t MaxQuads = 10000;
 		const uint32_t MaxVertices = MaxQuads * 4;
 		const uint32_t MaxIndices = MaxQuads * 6;
 		static const uint32_t MaxTextureSlots = 32; // TODO: RenderCapabilities
+		static const uint32_t StreamingRegionCount = 3;
 		
 		Ref<VertexArray> QuadVertexArray;
 		Ref<VertexBuffer> QuadVertexBuffer;
+		Ref<StreamingVertexBuffer> QuadStreamingBuffer; // Only set with Settings.StreamingBuffer
 		Ref<Shader> TextureColorShader;
+		Ref<Shader> StaticBatchShader; // Same as TextureColorShader unless quads use another vertex format
+		Ref<Shader> SpriteBatchShader; // Pulls SpriteBatch2D records from a storage buffer
+		ShaderLibrary Shaders;
 		Ref<Texture2D> WhiteTexture;
+		Ref<UniformBuffer> SceneUniformBuffer; // SceneData block, written once per scene
+
+		Renderer2DSettings Settings;
+
+		glm::mat4 ViewProjection;
+
+		// Visible rectangle as { min.x, min.y, -max.x, -max.y }, see IsQuadVisible
+		alignas(16) float CullBounds[4];
 
 		uint32_t QuadIndexCount = 0;
 		QuadVertex* QuadVertexBufferBase = nullptr;
 		QuadVertex* QuadVertexBufferPtr = nullptr;
 
+		// Only used with Settings.PackedVertices
+		PackedQuadVertex* PackedVertexBufferBase = nullptr;
+		PackedQuadVertex* PackedVertexBufferPtr = nullptr;
+
+		// Only used with Settings.Instanced
+		QuadInstance* QuadInstanceBufferBase = nullptr;
+		QuadInstance* QuadInstanceBufferPtr = nullptr;
+
 		std::array<Ref<Texture>, MaxTextureSlots> TextureSlots;
+		uint32_t TextureSlotCount = MaxTextureSlots; // Lowered to the reflected sampler array size
 		uint32_t TextureSlotIndex = 1; // 0 = white texture
+
+		// Texture handle -> (BatchIndex << 8 | slot). Entries from earlier batches are stale, so the
+		// table never has to be cleared when a batch starts.
+		std::vector<uint32_t> TextureSlotTable;
+		uint32_t BatchIndex = 0;
+
+		// Only used with Settings.SortQuads
+		std::vector<SortedQuad> SortedQuads;
+		std::vector<QuadSortKey> SortKeys, SortScratch;
+		std::vector<Ref<Texture2D>> SceneTextures; // Indexed by texture handle
+		std::vector<uint32_t> SceneTextureHandles;
+
+		Renderer2D::Statistics Stats;
+
+		// Unit quad centered on the origin, transformed on the CPU for DrawQuad(transform)
+		glm::vec4 QuadVertexPositions[4] =
+		{
+			{ -0.5f, -0.5f, 0.0f, 1.0f },
+			{  0.5f, -0.5f, 0.0f, 1.0f },
+			{  0.5f,  0.5f, 0.0f, 1.0f },
+			{ -0.5f,  0.5f, 0.0f, 1.0f }
+		};
+
+		glm::vec2 QuadTexCoords[4] =
+		{
+			{ 0.0f, 0.0f },
+			{ 1.0f, 0.0f },
+			{ 1.0f, 1.0f },
+			{ 0.0f, 1.0f }
+		};
 	};
 
-	static Renderer2DData* s_Data = new Renderer2DData();
+	static Renderer2DData* s_Data = nullptr;
 
-	void Renderer2D::Init()
+	void Renderer2D::Init(const Renderer2DSettings& settings)
 	{
 		HZ_PROFILE_FUNCTION()
+
+		HZ_CORE_ASSERT(!s_Data, "Renderer2D already initialized!")
+		s_Data = new Renderer2DData();
+		s_Data->Settings = settings;
+
+		// The recording thread can not wait on the region fences of a streaming buffer
+		if (RenderCommand::IsThreaded() && settings.StreamingBuffer)
+		{
+			HZ_CORE_WARN("Renderer2D streaming buffer is not available with a render thread")
+			s_Data->Settings.StreamingBuffer = false;
+		}
 		
+		// StaticBatch2D always uses QuadVertex, so TextureColorShader is loaded in any case. The
+		// shaders load on worker threads while the buffers are set up.
+		std::vector<ShaderSource> shaderSources =
+		{
+			{ "TextureColorShader", "", "assets/Shaders/Compiled/TextureColor.vs", "assets/Shaders/Compiled/TextureColor.fs" }
+		};
+		if (settings.Instanced)
+		{
+			shaderSources.push_back({ "", "assets/Shaders/TextureColorInstanced.glsl" });
+		}
+		else if (settings.PackedVertices)
+		{
+			shaderSources.push_back({ "", "assets/Shaders/TextureColorPacked.glsl" });
+		}
+		shaderSources.push_back({ "", "assets/Shaders/TextureColorSprite.glsl" });
+		auto shaders = s_Data->Shaders.Load(shaderSources);
+
 		// QuadVertexArray
 		s_Data->QuadVertexArray = VertexArray::Create();
 
-		s_Data->QuadVertexBuffer = VertexBuffer::Create(s_Data->MaxVertices * sizeof(QuadVertex));
-		s_Data->QuadVertexBuffer->SetLayout({
-			{ ShaderDataType::Float3, "a_Position" },
-			{ ShaderDataType::Float4, "a_Color" },
-			{ ShaderDataType::Float2, "a_TexCoords" },
-			{ ShaderDataType::Float,  "a_TexIndex" },
-			{ ShaderDataType::Float,  "a_TilingFactor" }
-		});
-		s_Data->QuadVertexArray->AddVertexBuffer(s_Data->QuadVertexBuffer);
+		BufferLayout layout;
+		uint32_t bufferSize = 0;
+		if (settings.Instanced)
+		{
+			layout = BufferLayout({
+				{ ShaderDataType::Float3,  "a_Center"                 },
+				{ ShaderDataType::Float,   "a_Rotation"               },
+				{ ShaderDataType::Float2,  "a_Size"                   },
+				{ ShaderDataType::UByte4,  "a_Color",          true   },
+				{ ShaderDataType::UShort2, "a_TexCoordMin",    true   },
+				{ ShaderDataType::UShort2, "a_TexCoordMax",    true   },
+				{ ShaderDataType::UInt,    "a_TexIndexTiling"         }
+			}, true /* instanced */);
+			bufferSize = s_Data->MaxQuads * sizeof(QuadInstance);
+		}
+		else if (settings.PackedVertices)
+		{
+			layout = {
+				{ ShaderDataType::Float3,  "a_Position"               },
+				{ ShaderDataType::UByte4,  "a_Color",          true   },
+				{ ShaderDataType::UShort2, "a_TexCoord",       true   },
+				{ ShaderDataType::UInt,    "a_TexIndexTiling"         }
+			};
+			bufferSize = s_Data->MaxVertices * sizeof(PackedQuadVertex);
+		}
+		else
+		{
+			layout = {
+				{ ShaderDataType::Float3, "a_Position" },
+				{ ShaderDataType::Float4, "a_Color" },
+				{ ShaderDataType::Float2, "a_TexCoord" },
+				{ ShaderDataType::Float,  "a_TexIndex" },
+				{ ShaderDataType::Float,  "a_TilingFactor" }
+			};
+			bufferSize = s_Data->MaxVertices * sizeof(QuadVertex);
+		}
 
-		s_Data->QuadVertexBufferBase = new QuadVertex[s_Data->MaxVertices];
-		
-		uint32_t* quadIndices = new uint32_t[s_Data->MaxIndices];
+		if (s_Data->Settings.StreamingBuffer)
+		{
+			// Quads are written straight into mapped GPU memory, see StartBatch
+			s_Data->QuadStreamingBuffer = StreamingVertexBuffer::Create(bufferSize, s_Data->StreamingRegionCount);
+			s_Data->QuadVertexBuffer = s_Data->QuadStreamingBuffer;
+		}
+		else
+		{
+			s_Data->QuadVertexBuffer = VertexBuffer::Create(bufferSize);
 
-		uint32_t offset = 0;
-		for (uint32_t i = 0; i < s_Data->MaxIndices; i += 6)
+			if (settings.Instanced)
+				s_Data->QuadInstanceBufferBase = new QuadInstance[s_Data->MaxQuads];
+			else if (settings.PackedVertices)
+				s_Data->PackedVertexBufferBase = new PackedQuadVertex[s_Data->MaxVertices];
+			else
+				s_Data->QuadVertexBufferBase = new QuadVertex[s_Data->MaxVertices];
+		}
+
+		s_Data->StaticBatchShader = shaders[0].get();
+		s_Data->SpriteBatchShader = shaders.back().get();
+		if (settings.Instanced || settings.PackedVertices)
+		{
+			s_Data->TextureColorShader = shaders[1].get();
+		}
+		else
 		{
-			quadIndices[i + 0] = offset + 0;
-			quadIndices[i + 1] = offset + 1;
-			quadIndices[i + 2] = offset + 2;
+			s_Data->TextureColorShader = s_Data->StaticBatchShader;
+		}
+
+		const ShaderReflection& reflection = s_Data->TextureColorShader->GetReflection();
+		reflection.ResolveLocations(layout);
+		s_Data->QuadVertexBuffer->SetLayout(layout);
+		s_Data->QuadVertexArray->AddVertexBuffer(s_Data->QuadVertexBuffer);
+		
+		// Instanced quads expand their corners from gl_VertexID and need no index buffer
+		if (!settings.Instanced)
+		{
+			uint32_t* quadIndices = new uint32_t[s_Data->MaxIndices];
+
+			uint32_t offset = 0;
+			for (uint32_t i = 0; i < s_Data->MaxIndices; i += 6)
+			{
+				quadIndices[i + 0] = offset + 0;
+				quadIndices[i + 1] = offset + 1;
+				quadIndices[i + 2] = offset + 2;
 			
-			quadIndices[i + 3] = offset + 2;
-			quadIndices[i + 4] = offset + 3;
-			quadIndices[i + 5] = offset + 0;
+				quadIndices[i + 3] = offset + 2;
+				quadIndices[i + 4] = offset + 3;
+				quadIndices[i + 5] = offset + 0;
 
-			offset += 4;
-		}
+				offset += 4;
+			}
 		
-		Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_Data->MaxIndices);
-		s_Data->QuadVertexArray->SetIndexBuffer(quadIB);
-		delete[] quadIndices;
+			Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_Data->MaxIndices);
+			s_Data->QuadVertexArray->SetIndexBuffer(quadIB);
+			delete[] quadIndices;
+		}
 		
-		// TextureColorShader
-		s_Data->TextureColorShader = Shader::CreateFromSpirv(
-			"TextureColorShader",
-			"assets/Shaders/Compiled/TextureColor.vs",
-			"assets/Shaders/Compiled/TextureColor.fs"
-		);
-		s_Data->TextureColorShader->Bind();
+
+		// Batches can't use more texture slots than the GPU can bind or the shaders have samplers for
+		s_Data->TextureSlotCount = std::min(Renderer2DData::MaxTextureSlots, RenderCommand::GetMaxTextureSlots());
+		for (auto& shader : shaders)
+		{
+			const ShaderReflection& shaderReflection = shader.get()->GetReflection();
+			if (auto sampler = shaderReflection.FindSampler("u_Textures"))
+				s_Data->TextureSlotCount = std::min(s_Data->TextureSlotCount, sampler->ArraySize);
+
+			auto sceneData = shaderReflection.FindUniformBlock("SceneData");
+			HZ_CORE_ASSERT(!sceneData || sceneData->Size == sizeof(glm::mat4), "Unexpected SceneData layout!")
+		}
 
 		int32_t samplers[s_Data->MaxTextureSlots];
 		for (uint32_t i = 0; i < s_Data->MaxTextureSlots; i++)
 			samplers[i] = i;
+
+		for (auto& shader : shaders)
+		{
+			shader.get()->Bind();
+			shader.get()->SetIntArray("u_Textures", samplers, s_Data->TextureSlotCount);
+		}
 		
-		s_Data->TextureColorShader->SetIntArray("u_Textures", samplers, s_Data->MaxTextureSlots);
-		
+		s_Data->SceneUniformBuffer = UniformBuffer::Create(sizeof(glm::mat4));
+
 		uint32_t white = 0xFFFFFFFF;
 		s_Data->WhiteTexture = Texture2D::Create(1, 1);
 		s_Data->WhiteTexture->SetData(&white, sizeof(uint32_t));
 
 		// Set slot 0 to white texture
 		s_Data->TextureSlots[0] = s_Data->WhiteTexture;
+		s_Data->TextureSlotTable.resize(s_Data->WhiteTexture->GetHandle() + 1, 0);
 	}
 
 	void Renderer2D::Shutdown()
 	{
 		HZ_PROFILE_FUNCTION()
+
+		// With a streaming buffer these point into mapped GPU memory owned by the buffer
+		if (!s_Data->QuadStreamingBuffer)
+		{
+			delete[] s_Data->QuadVertexBufferBase;
+			delete[] s_Data->PackedVertexBufferBase;
+			delete[] s_Data->QuadInstanceBufferBase;
+		}
+
 		delete s_Data;
+		s_Data = nullptr;
 	}
 
-	void Renderer2D::BeginScene(const OrthographicCamera& camera)
+	const Renderer2DSettings& Renderer2D::GetSettings()
 	{
-		HZ_PROFILE_FUNCTION()
-		
-		s_Data->TextureColorShader->Bind();
-		s_Data->TextureColorShader->SetMat4("u_SceneData.ViewProjection", camera.GetViewProjectionMatrix());
+		return s_Data->Settings;
+	}
+
+	static void StartBatch()
+	{
+		if (s_Data->QuadStreamingBuffer)
+		{
+			void* region = s_Data->QuadStreamingBuffer->BeginRegion();
+			if (s_Data->Settings.Instanced)
+				s_Data->QuadInstanceBufferBase = (QuadInstance*)region;
+			else if (s_Data->Settings.PackedVertices)
+				s_Data->PackedVertexBufferBase = (PackedQuadVertex*)region;
+			else
+				s_Data->QuadVertexBufferBase = (QuadVertex*)region;
+		}
 
 		s_Data->QuadIndexCount = 0;
 		s_Data->QuadVertexBufferPtr = s_Data->QuadVertexBufferBase;
+		s_Data->PackedVertexBufferPtr = s_Data->PackedVertexBufferBase;
+		s_Data->QuadInstanceBufferPtr = s_Data->QuadInstanceBufferBase;
 
 		s_Data->TextureSlotIndex = 1;
+
+		// 24 bits of batch index, clear the table once they wrap around
+		s_Data->BatchIndex = (s_Data->BatchIndex + 1) & 0xFFFFFF;
+		if (s_Data->BatchIndex == 0)
+		{
+			std::fill(s_Data->TextureSlotTable.begin(), s_Data->TextureSlotTable.end(), 0);
+			s_Data->BatchIndex = 1;
+		}
+
+		s_Data->TextureSlotTable[s_Data->WhiteTexture->GetHandle()] = s_Data->BatchIndex << 8;
+	}
+
+	static void NextBatch()
+	{
+		Renderer2D::Flush();
+		StartBatch();
 	}
 
+	void Renderer2D::BeginScene(const OrthographicCamera& camera)
+	{
+		HZ_PROFILE_FUNCTION()
+		
+		s_Data->ViewProjection = camera.GetViewProjectionMatrix();
+
+		s_Data->CullBounds[0] = camera.GetVisibleMin().x;
+		s_Data->CullBounds[1] = camera.GetVisibleMin().y;
+		s_Data->CullBounds[2] = -camera.GetVisibleMax().x;
+		s_Data->CullBounds[3] = -camera.GetVisibleMax().y;
+
+		s_Data->SceneUniformBuffer->SetData(&s_Data->ViewProjection, sizeof(glm::mat4));
+
+		StartBatch();
+	}
+
+	static void SubmitSortedQuads();
+
 	void Renderer2D::EndScene()
 	{
 		HZ_PROFILE_FUNCTION()
 
-		uint32_t dataSize = (uint8_t*)s_Data->QuadVertexBufferPtr - (uint8_t*)s_Data->QuadVertexBufferBase;
-		s_Data->QuadVertexBuffer->SetData(s_Data->QuadVertexBufferBase, dataSize);
+		if (s_Data->Settings.SortQuads)
+			SubmitSortedQuads();
+
 		Flush();
 	}
 
@@ -133,11 +389,480 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION()
 
+		if (s_Data->QuadIndexCount == 0)
+			return; // Nothing to draw
+
+		const void* data;
+		uint32_t dataSize, stride;
+		if (s_Data->Settings.Instanced)
+		{
+			data = s_Data->QuadInstanceBufferBase;
+			dataSize = (uint8_t*)s_Data->QuadInstanceBufferPtr - (uint8_t*)s_Data->QuadInstanceBufferBase;
+			stride = sizeof(QuadInstance);
+		}
+		else if (s_Data->Settings.PackedVertices)
+		{
+			data = s_Data->PackedVertexBufferBase;
+			dataSize = (uint8_t*)s_Data->PackedVertexBufferPtr - (uint8_t*)s_Data->PackedVertexBufferBase;
+			stride = sizeof(PackedQuadVertex);
+		}
+		else
+		{
+			data = s_Data->QuadVertexBufferBase;
+			dataSize = (uint8_t*)s_Data->QuadVertexBufferPtr - (uint8_t*)s_Data->QuadVertexBufferBase;
+			stride = sizeof(QuadVertex);
+		}
+
+		// A streaming buffer already holds the data, the draw just has to start at its region
+		uint32_t baseElement = 0;
+		if (s_Data->QuadStreamingBuffer)
+			baseElement = s_Data->QuadStreamingBuffer->GetRegionOffset() / stride;
+		else
+			s_Data->QuadVertexBuffer->SetData(data, dataSize);
+		s_Data->Stats.BytesUploaded += dataSize;
+
 		// Bind textures
 		for (uint32_t i = 0; i < s_Data->TextureSlotIndex; i++)
 			s_Data->TextureSlots[i]->Bind(i);
+		s_Data->Stats.TextureBinds += s_Data->TextureSlotIndex;
+
+		// Renderer::Submit may have bound its per-draw slice in between
+		s_Data->SceneUniformBuffer->Bind(0);
+
+		s_Data->TextureColorShader->Bind();
 		
-		RenderCommand::DrawIndexed(s_Data->QuadVertexArray, s_Data->QuadIndexCount);
+		s_Data->QuadVertexArray->Bind();
+		if (s_Data->Settings.Instanced)
+			RenderCommand::DrawArraysInstanced(s_Data->QuadVertexArray, 6, s_Data->QuadIndexCount / 6, baseElement);
+		else
+			RenderCommand::DrawIndexed(s_Data->QuadVertexArray, s_Data->QuadIndexCount, baseElement);
+		s_Data->Stats.DrawCalls++;
+
+		if (s_Data->QuadStreamingBuffer)
+			s_Data->QuadStreamingBuffer->EndRegion();
+	}
+
+	// Must be called before the quad's texture index is resolved, since starting a new batch
+	// resets the texture slots
+	static void EnsureQuadCapacity()
+	{
+		if (s_Data->QuadIndexCount >= s_Data->MaxIndices)
+			NextBatch();
+	}
+
+	static float GetTextureIndex(const Ref<Texture2D>& texture)
+	{
+		uint32_t handle = texture->GetHandle();
+		if (handle >= s_Data->TextureSlotTable.size())
+			s_Data->TextureSlotTable.resize(handle + 1, 0);
+
+		uint32_t entry = s_Data->TextureSlotTable[handle];
+		if ((entry >> 8) == s_Data->BatchIndex)
+			return (float)(entry & 0xFF);
+
+		if (s_Data->TextureSlotIndex >= s_Data->TextureSlotCount)
+			NextBatch();
+
+		uint32_t textureIndex = s_Data->TextureSlotIndex;
+		s_Data->TextureSlots[textureIndex] = texture;
+		s_Data->TextureSlotTable[handle] = (s_Data->BatchIndex << 8) | textureIndex;
+		s_Data->TextureSlotIndex++;
+
+		return (float)textureIndex;
+	}
+
+	static uint16_t PackTexCoord(float texCoord)
+	{
+		return (uint16_t)(glm::clamp(texCoord, 0.0f, 1.0f) * 65535.0f + 0.5f);
+	}
+
+	static void SubmitQuadInstance(
+		const glm::vec3& center,
+		const glm::vec2& size,
+		float rotation,
+		const glm::vec4& color,
+		float textureIndex,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		s_Data->QuadInstanceBufferPtr->Center = center;
+		s_Data->QuadInstanceBufferPtr->Rotation = rotation;
+		s_Data->QuadInstanceBufferPtr->Size = size;
+		s_Data->QuadInstanceBufferPtr->Color = glm::packUnorm4x8(color);
+		s_Data->QuadInstanceBufferPtr->TexCoordMin[0] = PackTexCoord(texCoords[0].x);
+		s_Data->QuadInstanceBufferPtr->TexCoordMin[1] = PackTexCoord(texCoords[0].y);
+		s_Data->QuadInstanceBufferPtr->TexCoordMax[0] = PackTexCoord(texCoords[2].x);
+		s_Data->QuadInstanceBufferPtr->TexCoordMax[1] = PackTexCoord(texCoords[2].y);
+		s_Data->QuadInstanceBufferPtr->TexIndexTiling =
+			(uint32_t)textureIndex | ((uint32_t)glm::packHalf1x16(tilingFactor) << 16);
+		s_Data->QuadInstanceBufferPtr++;
+
+		// Keep counting indices so batch capacity works the same in every mode
+		s_Data->QuadIndexCount += 6;
+
+		s_Data->Stats.QuadCount++;
+		s_Data->Stats.VertexCount += 4;
+		s_Data->Stats.IndexCount += 6;
+	}
+
+	static void SubmitQuad(
+		const glm::vec3* positions,
+		const glm::vec4& color,
+		float textureIndex,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		if (s_Data->Settings.Instanced)
+		{
+			// Recover the instance from the corners, which only happens for sorted quads
+			glm::vec3 center = (positions[0] + positions[2]) * 0.5f;
+			glm::vec3 edgeX = positions[1] - positions[0];
+			glm::vec3 edgeY = positions[3] - positions[0];
+			glm::vec2 size = {
+				glm::length(glm::vec2(edgeX.x, edgeX.y)),
+				glm::length(glm::vec2(edgeY.x, edgeY.y))
+			};
+			float rotation = atan2f(edgeX.y, edgeX.x);
+
+			SubmitQuadInstance(center, size, rotation, color, textureIndex, tilingFactor, texCoords);
+			return;
+		}
+
+		if (s_Data->Settings.PackedVertices)
+		{
+			uint32_t packedColor = glm::packUnorm4x8(color);
+			uint32_t texIndexTiling = (uint32_t)textureIndex | ((uint32_t)glm::packHalf1x16(tilingFactor) << 16);
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				s_Data->PackedVertexBufferPtr->Position = positions[i];
+				s_Data->PackedVertexBufferPtr->Color = packedColor;
+				s_Data->PackedVertexBufferPtr->TexCoord[0] = PackTexCoord(texCoords[i].x);
+				s_Data->PackedVertexBufferPtr->TexCoord[1] = PackTexCoord(texCoords[i].y);
+				s_Data->PackedVertexBufferPtr->TexIndexTiling = texIndexTiling;
+				s_Data->PackedVertexBufferPtr++;
+			}
+		}
+		else
+		{
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				s_Data->QuadVertexBufferPtr->Position = positions[i];
+				s_Data->QuadVertexBufferPtr->Color = color;
+				s_Data->QuadVertexBufferPtr->TexCoord = texCoords[i];
+				s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
+				s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
+				s_Data->QuadVertexBufferPtr++;
+			}
+		}
+
+		s_Data->QuadIndexCount += 6;
+
+		s_Data->Stats.QuadCount++;
+		s_Data->Stats.VertexCount += 4;
+		s_Data->Stats.IndexCount += 6;
+	}
+
+	static void GetQuadPositions(const glm::vec3& position, const glm::vec2& size, glm::vec3* positions)
+	{
+		positions[0] = position;
+		positions[1] = { position.x + size.x, position.y, position.z };
+		positions[2] = { position.x + size.x, position.y + size.y, position.z };
+		positions[3] = { position.x, position.y + size.y, position.z };
+	}
+
+	static void GetQuadPositions(const glm::mat4& transform, glm::vec3* positions)
+	{
+		for (uint32_t i = 0; i < 4; i++)
+			positions[i] = glm::vec3(transform * s_Data->QuadVertexPositions[i]);
+	}
+
+	// Rotates around the center of the quad, so that a rotation of 0 matches DrawQuad
+	static glm::mat4 GetRotatedQuadTransform(const glm::vec3& position, const glm::vec2& size, float rotation)
+	{
+		glm::vec3 center = { position.x + size.x * 0.5f, position.y + size.y * 0.5f, position.z };
+
+		glm::mat4 transform = glm::translate(glm::mat4(1.0f), center);
+		transform = glm::rotate(transform, rotation, { 0.0f, 0.0f, 1.0f });
+		transform = glm::scale(transform, glm::vec3(size, 1.0f));
+		return transform;
+	}
+
+	static void SubmitQuad(
+		const glm::mat4& transform,
+		const glm::vec4& color,
+		float textureIndex,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		if (s_Data->Settings.Instanced)
+		{
+			// Instances only carry translation, rotation around Z and scale, any shear is lost
+			glm::vec3 center = glm::vec3(transform[3]);
+			glm::vec2 size = {
+				glm::length(glm::vec2(transform[0].x, transform[0].y)),
+				glm::length(glm::vec2(transform[1].x, transform[1].y))
+			};
+			float rotation = atan2f(transform[0].y, transform[0].x);
+
+			SubmitQuadInstance(center, size, rotation, color, textureIndex, tilingFactor, texCoords);
+			return;
+		}
+
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+
+		SubmitQuad(positions, color, textureIndex, tilingFactor, texCoords);
+	}
+
+	static void SubmitQuad(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		const glm::vec4& color,
+		float textureIndex,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		if (s_Data->Settings.Instanced)
+		{
+			glm::vec3 center = { position.x + size.x * 0.5f, position.y + size.y * 0.5f, position.z };
+			SubmitQuadInstance(center, size, 0.0f, color, textureIndex, tilingFactor, texCoords);
+			return;
+		}
+
+		glm::vec3 positions[4];
+		GetQuadPositions(position, size, positions);
+
+		SubmitQuad(positions, color, textureIndex, tilingFactor, texCoords);
+	}
+
+	static void SubmitQuad(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		float rotation,
+		const glm::vec4& color,
+		float textureIndex,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		if (s_Data->Settings.Instanced)
+		{
+			glm::vec3 center = { position.x + size.x * 0.5f, position.y + size.y * 0.5f, position.z };
+			SubmitQuadInstance(center, size, rotation, color, textureIndex, tilingFactor, texCoords);
+			return;
+		}
+
+		SubmitQuad(GetRotatedQuadTransform(position, size, rotation), color, textureIndex, tilingFactor, texCoords);
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// Sorted mode ////////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	// Maps a float to an unsigned integer with the same ordering
+	static uint32_t OrderedFloatBits(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(uint32_t));
+		return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+	}
+
+	// Sort key, lowest is drawn first:
+	//   opaque:      [63] 0 | [62..39] texture handle | [38..7] depth, front to back
+	//   translucent: [63] 1 | [62..31] depth, back to front | [30..7] texture handle
+	// Opaque quads rely on the depth test and are grouped by texture over the whole scene.
+	// Translucent quads keep their back to front order and are only grouped by texture
+	// within the same depth.
+	static uint64_t GetQuadSortKey(const glm::vec3* positions, const glm::vec4& color, const Ref<Texture2D>& texture)
+	{
+		bool opaque = color.a >= 1.0f && (texture == s_Data->WhiteTexture || !texture->HasAlpha());
+
+		float depth = (positions[0].z + positions[1].z + positions[2].z + positions[3].z) * 0.25f;
+		uint64_t depthBits = OrderedFloatBits(depth);
+		uint64_t handle = texture->GetHandle() & 0xFFFFFF;
+
+		if (opaque)
+			return (handle << 39) | ((uint64_t)(~(uint32_t)depthBits) << 7);
+
+		return (1ull << 63) | (depthBits << 31) | (handle << 7);
+	}
+
+	static void RecordQuad(
+		const glm::vec3* positions,
+		const glm::vec4& color,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		uint32_t handle = texture->GetHandle();
+		if (handle >= s_Data->SceneTextures.size())
+			s_Data->SceneTextures.resize(handle + 1);
+
+		// Keep the texture alive until EndScene, but only pay for the Ref copy once per scene
+		if (s_Data->SceneTextures[handle] != texture)
+		{
+			s_Data->SceneTextures[handle] = texture;
+			s_Data->SceneTextureHandles.push_back(handle);
+		}
+
+		SortedQuad quad;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			quad.Positions[i] = positions[i];
+			quad.TexCoords[i] = texCoords[i];
+		}
+		quad.Color = color;
+		quad.TilingFactor = tilingFactor;
+		quad.TextureHandle = handle;
+
+		s_Data->SortKeys.push_back({ GetQuadSortKey(positions, color, texture), (uint32_t)s_Data->SortedQuads.size() });
+		s_Data->SortedQuads.push_back(quad);
+	}
+
+	static void RecordQuad(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		const glm::vec4& color,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		glm::vec3 positions[4];
+		GetQuadPositions(position, size, positions);
+		RecordQuad(positions, color, texture, tilingFactor, texCoords);
+	}
+
+	static void RecordQuad(
+		const glm::mat4& transform,
+		const glm::vec4& color,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		RecordQuad(positions, color, texture, tilingFactor, texCoords);
+	}
+
+	// LSD radix sort on 8 bit digits, stable so equal keys keep their submission order
+	static void RadixSort(std::vector<QuadSortKey>& keys, std::vector<QuadSortKey>& scratch)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		scratch.resize(keys.size());
+
+		for (uint32_t shift = 0; shift < 64; shift += 8)
+		{
+			uint32_t counts[256] = {};
+			for (const auto& key : keys)
+				counts[(key.Key >> shift) & 0xFF]++;
+
+			// All keys share this digit, nothing to reorder
+			if (counts[(keys[0].Key >> shift) & 0xFF] == keys.size())
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t i = 0; i < 256; i++)
+			{
+				uint32_t count = counts[i];
+				counts[i] = offset;
+				offset += count;
+			}
+
+			for (const auto& key : keys)
+				scratch[counts[(key.Key >> shift) & 0xFF]++] = key;
+
+			keys.swap(scratch);
+		}
+	}
+
+	static void SubmitSortedQuads()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (!s_Data->SortKeys.empty())
+			RadixSort(s_Data->SortKeys, s_Data->SortScratch);
+
+		for (const auto& key : s_Data->SortKeys)
+		{
+			const SortedQuad& quad = s_Data->SortedQuads[key.Index];
+
+			EnsureQuadCapacity();
+
+			float textureIndex = GetTextureIndex(s_Data->SceneTextures[quad.TextureHandle]);
+			SubmitQuad(quad.Positions, quad.Color, textureIndex, quad.TilingFactor, quad.TexCoords);
+		}
+
+		s_Data->SortKeys.clear();
+		s_Data->SortedQuads.clear();
+
+		for (uint32_t handle : s_Data->SceneTextureHandles)
+			s_Data->SceneTextures[handle] = nullptr;
+		s_Data->SceneTextureHandles.clear();
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// Culling ////////////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	// Takes any two opposite corners of the quad's bounding box. Overlap with the visible
+	// rectangle is a single 4-wide compare: { max.x, max.y, -min.x, -min.y } >= CullBounds.
+	static bool IsQuadVisible(float x0, float y0, float x1, float y1)
+	{
+		__m128 corners = _mm_setr_ps(x0, y0, x1, y1);
+		__m128 swapped = _mm_shuffle_ps(corners, corners, _MM_SHUFFLE(1, 0, 3, 2));
+		__m128 max = _mm_max_ps(corners, swapped);
+		__m128 min = _mm_min_ps(corners, swapped);
+
+		__m128 bounds = _mm_shuffle_ps(max, min, _MM_SHUFFLE(1, 0, 1, 0));
+		bounds = _mm_xor_ps(bounds, _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+
+		__m128 outside = _mm_cmplt_ps(bounds, _mm_load_ps(s_Data->CullBounds));
+		return _mm_movemask_ps(outside) == 0;
+	}
+
+	static bool CullBounds(float x0, float y0, float x1, float y1)
+	{
+		if (!s_Data->Settings.FrustumCulling || IsQuadVisible(x0, y0, x1, y1))
+			return false;
+
+		s_Data->Stats.CulledQuadCount++;
+		return true;
+	}
+
+	static bool CullQuad(const glm::vec3& position, const glm::vec2& size)
+	{
+		return CullBounds(position.x, position.y, position.x + size.x, position.y + size.y);
+	}
+
+	static bool CullQuad(const glm::mat4& transform)
+	{
+		// Half extents of the transformed unit quad's bounding box
+		float extentX = (fabsf(transform[0].x) + fabsf(transform[1].x)) * 0.5f;
+		float extentY = (fabsf(transform[0].y) + fabsf(transform[1].y)) * 0.5f;
+
+		return CullBounds(
+			transform[3].x - extentX, transform[3].y - extentY,
+			transform[3].x + extentX, transform[3].y + extentY
+		);
+	}
+
+	// Bounded by the circle through the corners, so the rotation needs no sin/cos
+	static bool CullRotatedQuad(const glm::vec3& position, const glm::vec2& size)
+	{
+		float centerX = position.x + size.x * 0.5f;
+		float centerY = position.y + size.y * 0.5f;
+		float radius = glm::length(size) * 0.5f;
+
+		return CullBounds(centerX - radius, centerY - radius, centerX + radius, centerY + radius);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
@@ -149,38 +874,18 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION()
 
+		if (CullQuad(position, size))
+			return;
+
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(position, size, color, s_Data->WhiteTexture, 1.0f, s_Data->QuadTexCoords);
+
+		EnsureQuadCapacity();
+
 		float textureIndex = 0.0f; // white texture
 		float tilingFactor = 1.0f; // no tiling
 
-		s_Data->QuadVertexBufferPtr->Position = position;
-		s_Data->QuadVertexBufferPtr->Color = color;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 0.0f, 0.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
-
-		s_Data->QuadVertexBufferPtr->Position = { position.x + size.x, position.y, position.z };
-		s_Data->QuadVertexBufferPtr->Color = color;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 1.0f, 0.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
-
-		s_Data->QuadVertexBufferPtr->Position = { position.x + size.x, position.y + size.y, position.z };
-		s_Data->QuadVertexBufferPtr->Color = color;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 1.0f, 1.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
-
-		s_Data->QuadVertexBufferPtr->Position = { position.x, position.y + size.y, position.z };
-		s_Data->QuadVertexBufferPtr->Color = color;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 0.0f, 1.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
-
-		s_Data->QuadIndexCount += 6;
+		SubmitQuad(position, size, color, textureIndex, tilingFactor, s_Data->QuadTexCoords);
 	}
 
 	void Renderer2D::DrawQuad(
@@ -204,52 +909,55 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION()
 
-		float textureIndex = 0.0f;
-		for (uint32_t i = 0; i < s_Data->TextureSlotIndex; i++)
-		{
-			if (*s_Data->TextureSlots[i].get() == *texture.get())
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-		if (textureIndex == 0.0f)
-		{
-			textureIndex = (float)s_Data->TextureSlotIndex;
-			s_Data->TextureSlots[s_Data->TextureSlotIndex] = texture;
-			s_Data->TextureSlotIndex++;
-			
-		}
-		
-		s_Data->QuadVertexBufferPtr->Position = position;
-		s_Data->QuadVertexBufferPtr->Color = tintColor;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 0.0f, 0.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
-
-		s_Data->QuadVertexBufferPtr->Position = { position.x + size.x, position.y, position.z };
-		s_Data->QuadVertexBufferPtr->Color = tintColor;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 1.0f, 0.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
-
-		s_Data->QuadVertexBufferPtr->Position = { position.x + size.x, position.y + size.y, position.z };
-		s_Data->QuadVertexBufferPtr->Color = tintColor;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 1.0f, 1.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
-
-		s_Data->QuadVertexBufferPtr->Position = { position.x, position.y + size.y, position.z };
-		s_Data->QuadVertexBufferPtr->Color = tintColor;
-		s_Data->QuadVertexBufferPtr->TexCoord = { 0.0f, 1.0f };
-		s_Data->QuadVertexBufferPtr->TexIndex = textureIndex;
-		s_Data->QuadVertexBufferPtr->TilingFactor = tilingFactor;
-		s_Data->QuadVertexBufferPtr++;
+		if (CullQuad(position, size))
+			return;
 
-		s_Data->QuadIndexCount += 6;
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(position, size, tintColor, texture, tilingFactor, s_Data->QuadTexCoords);
+
+		EnsureQuadCapacity();
+
+		float textureIndex = GetTextureIndex(texture);
+		SubmitQuad(position, size, tintColor, textureIndex, tilingFactor, s_Data->QuadTexCoords);
+	}
+
+	void Renderer2D::DrawQuad(const glm::mat4& transform, const glm::vec4& color)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (CullQuad(transform))
+			return;
+
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(transform, color, s_Data->WhiteTexture, 1.0f, s_Data->QuadTexCoords);
+
+		EnsureQuadCapacity();
+
+		float textureIndex = 0.0f; // white texture
+		float tilingFactor = 1.0f; // no tiling
+
+		SubmitQuad(transform, color, textureIndex, tilingFactor, s_Data->QuadTexCoords);
+	}
+
+	void Renderer2D::DrawQuad(
+		const glm::mat4& transform,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec4& tintColor
+	)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (CullQuad(transform))
+			return;
+
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(transform, tintColor, texture, tilingFactor, s_Data->QuadTexCoords);
+
+		EnsureQuadCapacity();
+
+		float textureIndex = GetTextureIndex(texture);
+		SubmitQuad(transform, tintColor, textureIndex, tilingFactor, s_Data->QuadTexCoords);
 	}
 
 	void Renderer2D::DrawRotatedQuad(
@@ -270,21 +978,19 @@ namespace Hazel {
 	)
 	{
 		HZ_PROFILE_FUNCTION()
-		
-		glm::mat4 transform = glm::mat4(1.0f);
-		transform = glm::translate(transform, position);
-		transform = glm::rotate(transform, rotation, { 0.0f, 0.0f, 1.0f });
-		transform = glm::scale(transform, glm::vec3(size, 1.0f));
 
-		s_Data->TextureColorShader->Bind();
-		s_Data->TextureColorShader->SetMat4("u_SceneData.Transform", transform);
-		s_Data->TextureColorShader->SetFloat4("u_RenderData.Color", color);
-		s_Data->TextureColorShader->SetFloat("u_RenderData.TilingFactor", 1.0f);
+		if (CullRotatedQuad(position, size))
+			return;
 
-		s_Data->WhiteTexture->Bind(0);
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(GetRotatedQuadTransform(position, size, rotation), color, s_Data->WhiteTexture, 1.0f, s_Data->QuadTexCoords);
 
-		s_Data->QuadVertexArray->Bind();
-		RenderCommand::DrawIndexed(s_Data->QuadVertexArray);
+		EnsureQuadCapacity();
+
+		float textureIndex = 0.0f; // white texture
+		float tilingFactor = 1.0f; // no tiling
+
+		SubmitQuad(position, size, rotation, color, textureIndex, tilingFactor, s_Data->QuadTexCoords);
 	}
 
 	void Renderer2D::DrawRotatedQuad(
@@ -316,20 +1022,188 @@ namespace Hazel {
 	)
 	{
 		HZ_PROFILE_FUNCTION()
-		
-		glm::mat4 transform = glm::mat4(1.0f);
-		transform = glm::translate(transform, position);
-		transform = glm::rotate(transform, rotation, { 0.0f, 0.0f, 1.0f });
-		transform = glm::scale(transform, glm::vec3(size, 1.0f));
 
-		s_Data->TextureColorShader->Bind();
-		s_Data->TextureColorShader->SetMat4("u_SceneData.Transform", transform);
-		s_Data->TextureColorShader->SetFloat4("u_RenderData.Color", tintColor);
-		s_Data->TextureColorShader->SetFloat("u_RenderData.TilingFactor", tilingFactor);
+		if (CullRotatedQuad(position, size))
+			return;
 
-		texture->Bind(0);
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(GetRotatedQuadTransform(position, size, rotation), tintColor, texture, tilingFactor, s_Data->QuadTexCoords);
 
-		s_Data->QuadVertexArray->Bind();
-		RenderCommand::DrawIndexed(s_Data->QuadVertexArray);
+		EnsureQuadCapacity();
+
+		float textureIndex = GetTextureIndex(texture);
+		SubmitQuad(position, size, rotation, tintColor, textureIndex, tilingFactor, s_Data->QuadTexCoords);
+	}
+
+	void Renderer2D::DrawQuad(
+		const glm::vec2& position,
+		const glm::vec2& size,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		DrawQuad({ position.x, position.y, 0.0f }, size, subTexture, tintColor);
+	}
+
+	void Renderer2D::DrawQuad(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (CullQuad(position, size))
+			return;
+
+		const Ref<Texture2D>& texture = subTexture->GetTexture();
+		const glm::vec2* texCoords = subTexture->GetTexCoords();
+
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(position, size, tintColor, texture, 1.0f, texCoords);
+
+		EnsureQuadCapacity();
+
+		float textureIndex = GetTextureIndex(texture);
+		SubmitQuad(position, size, tintColor, textureIndex, 1.0f, texCoords);
+	}
+
+	void Renderer2D::DrawQuad(
+		const glm::mat4& transform,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (CullQuad(transform))
+			return;
+
+		const Ref<Texture2D>& texture = subTexture->GetTexture();
+		const glm::vec2* texCoords = subTexture->GetTexCoords();
+
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(transform, tintColor, texture, 1.0f, texCoords);
+
+		EnsureQuadCapacity();
+
+		float textureIndex = GetTextureIndex(texture);
+		SubmitQuad(transform, tintColor, textureIndex, 1.0f, texCoords);
+	}
+
+	void Renderer2D::DrawRotatedQuad(
+		const glm::vec2& position,
+		const glm::vec2& size,
+		float rotation,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, subTexture, tintColor);
+	}
+
+	void Renderer2D::DrawRotatedQuad(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		float rotation,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (CullRotatedQuad(position, size))
+			return;
+
+		const Ref<Texture2D>& texture = subTexture->GetTexture();
+		const glm::vec2* texCoords = subTexture->GetTexCoords();
+
+		if (s_Data->Settings.SortQuads)
+			return RecordQuad(GetRotatedQuadTransform(position, size, rotation), tintColor, texture, 1.0f, texCoords);
+
+		EnsureQuadCapacity();
+
+		float textureIndex = GetTextureIndex(texture);
+		SubmitQuad(position, size, rotation, tintColor, textureIndex, 1.0f, texCoords);
+	}
+
+	void Renderer2D::DrawStaticBatch(const Ref<StaticBatch2D>& batch)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (batch->GetQuadCount() == 0)
+			return;
+
+		// Quads submitted so far are drawn first. Sorted quads are only recorded, they are drawn
+		// at EndScene after the batch.
+		NextBatch();
+
+		s_Data->Stats.BytesUploaded += batch->Upload();
+
+		s_Data->StaticBatchShader->Bind();
+		s_Data->SceneUniformBuffer->Bind(0);
+
+		const auto& textures = batch->GetTextures();
+		HZ_CORE_ASSERT(textures.size() < s_Data->TextureSlotCount, "Static batch has more textures than the shader has slots!")
+		s_Data->WhiteTexture->Bind(0);
+		for (uint32_t i = 0; i < textures.size(); i++)
+			textures[i]->Bind(i + 1);
+		s_Data->Stats.TextureBinds += (uint32_t)textures.size() + 1;
+
+		batch->GetVertexArray()->Bind();
+		RenderCommand::DrawIndexed(batch->GetVertexArray(), batch->GetQuadCount() * 6);
+		s_Data->Stats.DrawCalls++;
+		s_Data->Stats.QuadCount += batch->GetQuadCount();
+		s_Data->Stats.VertexCount += batch->GetQuadCount() * 4;
+		s_Data->Stats.IndexCount += batch->GetQuadCount() * 6;
+	}
+
+	void Renderer2D::DrawSpriteBatch(const Ref<SpriteBatch2D>& batch)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(
+			RendererAPI::GetAPI() != RendererAPI::API::Software,
+			"Software renderer does not support vertex pulling!"
+		)
+
+		if (batch->GetSpriteCount() == 0)
+			return;
+
+		// Quads submitted so far are drawn first. Sorted quads are only recorded, they are drawn
+		// at EndScene after the batch.
+		NextBatch();
+
+		uint32_t bytesUploaded = batch->Upload();
+		s_Data->Stats.BytesUploaded += bytesUploaded;
+		s_Data->Stats.SpriteBytesUploaded += bytesUploaded;
+
+		s_Data->SpriteBatchShader->Bind();
+		s_Data->SceneUniformBuffer->Bind(0);
+		batch->GetStorageBuffer()->Bind(0); // Sprites block
+
+		const auto& textures = batch->GetTextures();
+		HZ_CORE_ASSERT(textures.size() < s_Data->TextureSlotCount, "Sprite batch has more textures than the shader has slots!")
+		s_Data->WhiteTexture->Bind(0);
+		for (uint32_t i = 0; i < textures.size(); i++)
+			textures[i]->Bind(i + 1);
+		s_Data->Stats.TextureBinds += (uint32_t)textures.size() + 1;
+
+		batch->GetVertexArray()->Bind();
+		RenderCommand::DrawIndexed(batch->GetVertexArray(), batch->GetSpriteCount() * 6);
+		s_Data->Stats.DrawCalls++;
+		s_Data->Stats.QuadCount += batch->GetSpriteCount();
+		s_Data->Stats.VertexCount += batch->GetSpriteCount() * 4;
+		s_Data->Stats.IndexCount += batch->GetSpriteCount() * 6;
+	}
+
+	Renderer2D::Statistics Renderer2D::GetStats()
+	{
+		return s_Data->Stats;
+	}
+
+	void Renderer2D::ResetStats()
+	{
+		s_Data->Stats = Statistics();
 	}
 }
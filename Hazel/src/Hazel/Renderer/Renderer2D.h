@@ -1,16 +1,43 @@
 #pragma once
 
 #include "Hazel/Renderer/Texture.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+#include "Hazel/Renderer/StaticBatch2D.h"
+#include "Hazel/Renderer/SpriteBatch2D.h"
 #include "Hazel/Camera/OrthographicCamera.h"
 
 namespace Hazel {
 
+	struct Renderer2DSettings
+	{
+		// Use the 24 byte packed quad vertex (RGBA8 color, 16-bit texcoords) instead of the 48 byte one
+		bool PackedVertices = false;
+
+		// Submit one 40 byte record per quad and expand the corners on the GPU with instanced draws.
+		// Takes precedence over PackedVertices.
+		bool Instanced = false;
+
+		// Write quads straight into a persistently mapped, fenced ring of vertex buffer regions
+		// instead of a CPU staging array that is copied with glBufferSubData on every flush
+		bool StreamingBuffer = false;
+
+		// Record quads and emit them at EndScene ordered by a sort key (blend mode, depth, texture),
+		// so quads sharing a texture end up in the same batch. Quads at the same depth may be
+		// reordered by texture.
+		bool SortQuads = false;
+
+		// Skip quads outside the camera's visible rectangle before any vertex is written
+		bool FrustumCulling = true;
+	};
+
 	class HAZEL_API Renderer2D
 	{
 	public:
-		static void Init();
+		static void Init(const Renderer2DSettings& settings = Renderer2DSettings());
 		static void Shutdown();
 
+		static const Renderer2DSettings& GetSettings();
+
 		static void BeginScene(const OrthographicCamera& camera);
 		static void EndScene();
 
@@ -36,6 +63,17 @@ namespace Hazel {
 			const glm::vec4& tintColor = glm::vec4(1.0f)
 		);
 
+		// Transformed unit quad centered on the origin
+		static void DrawQuad(const glm::mat4& transform, const glm::vec4& color);
+
+		static void DrawQuad(
+			const glm::mat4& transform,
+			const Ref<Texture2D>& texture,
+			float tilingFactor = 1.0f,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		// Rotation is in radians around the center of the quad
 		static void DrawRotatedQuad(
 			const glm::vec2& position, 
 			const glm::vec2& size, 
@@ -67,6 +105,67 @@ namespace Hazel {
 			float tilingFactor = 1.0f,
 			const glm::vec4& tintColor = glm::vec4(1.0f)
 		);
+
+		// Sub textures cover only part of their texture, so they are drawn without tiling
+		static void DrawQuad(
+			const glm::vec2& position,
+			const glm::vec2& size,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		static void DrawQuad(
+			const glm::vec3& position,
+			const glm::vec2& size,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		static void DrawQuad(
+			const glm::mat4& transform,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		static void DrawRotatedQuad(
+			const glm::vec2& position,
+			const glm::vec2& size,
+			float rotation,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		static void DrawRotatedQuad(
+			const glm::vec3& position,
+			const glm::vec2& size,
+			float rotation,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		// Draws the whole batch with one call, after flushing the quads submitted so far.
+		// In sorted mode it is drawn before all sorted quads.
+		static void DrawStaticBatch(const Ref<StaticBatch2D>& batch);
+		// Same, but only the sprites that changed since the last draw are uploaded
+		static void DrawSpriteBatch(const Ref<SpriteBatch2D>& batch);
+
+		// Stats
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t QuadCount = 0;
+			uint32_t CulledQuadCount = 0;
+			// 4 vertices and 6 indices per quad in every mode, also where instanced quads are
+			// expanded in the vertex shader
+			uint32_t VertexCount = 0;
+			uint32_t IndexCount = 0;
+			uint32_t TextureBinds = 0;
+			uint64_t BytesUploaded = 0;
+			uint64_t SpriteBytesUploaded = 0; // Part of BytesUploaded, by DrawSpriteBatch
+		};
+
+		static Statistics GetStats();
+		static void ResetStats();
 	};
 
 }
\ No newline at end of file
@@ -1,8 +1,35 @@
 #include "hzpch.h"
 #include "RendererAPI.h"
 
+#include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
+#include "Platform/Software/SoftwareRendererAPI.h"
+
 namespace Hazel {
 
 	RendererAPI::API RendererAPI::s_API = API::OpenGL;
 
+	RendererAPI* RendererAPI::Create()
+	{
+		switch (s_API)
+		{
+			case API::None:
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!")
+				return nullptr;
+
+			case API::OpenGL:
+				return new OpenGLRendererAPI();
+
+			case API::Null:
+				return new NullRendererAPI();
+
+			case API::Software:
+				return new SoftwareRendererAPI();
+
+			default:
+				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
+				return nullptr;
+		}
+	}
+
 }
\ No newline at end of file
@@ -6,24 +6,79 @@
 
 namespace Hazel {
 
+	// Same layout as GL's DrawElementsIndirectCommand
+	struct DrawIndexedIndirectCommand
+	{
+		uint32_t Count;
+		uint32_t InstanceCount;
+		uint32_t FirstIndex;
+		int32_t BaseVertex;
+		uint32_t BaseInstance;
+	};
+
+	// State binds requested from the backend, and how many of them it skipped because the
+	// state was already set
+	struct BindStatistics
+	{
+		uint32_t Binds = 0;
+		uint32_t SkippedBinds = 0;
+	};
+
 	class HAZEL_API RendererAPI
 	{
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1
+			None = 0, OpenGL = 1, Null = 2, Software = 3
 		};
 
 	public:
+		virtual ~RendererAPI() = default;
+
 		virtual void Init() = 0;
 
 		virtual void SetClearColor(const glm::vec4& color) = 0;
 		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 		
 		virtual void Clear() = 0;
-		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+		virtual void DrawIndexed(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t indexCount = 0,
+			uint32_t baseVertex = 0,
+			uint32_t firstIndex = 0
+		) = 0;
+		virtual void DrawArraysInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t vertexCount,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0
+		) = 0;
+		// 0 indices = the whole index buffer
+		virtual void DrawIndexedInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0,
+			uint32_t indexCount = 0
+		) = 0;
+		// One draw per command from the vertex array's index buffer, in as few calls as the
+		// backend can manage. Instanced attributes start at each command's BaseInstance.
+		virtual void DrawIndexedIndirect(
+			const Ref<VertexArray>& vertexArray,
+			const DrawIndexedIndirectCommand* commands,
+			uint32_t count
+		) = 0;
+
+		// Texture units a single shader can sample from, valid after Init
+		virtual uint32_t GetMaxTextureSlots() const = 0;
+
+		virtual BindStatistics GetBindStats() const = 0;
+		virtual void ResetBindStats() = 0;
 
 		inline static API GetAPI() { return s_API; }
+		// Must be called before Renderer::Init
+		inline static void SetAPI(API api) { s_API = api; }
+
+		static RendererAPI* Create();
 
 	private:
 		static API s_API;
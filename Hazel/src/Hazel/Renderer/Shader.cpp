@@ -2,7 +2,10 @@
 #include "Shader.h"
 
 #include "Renderer.h"
+#include "ShaderCache.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Null/NullShader.h"
+#include "Platform/Software/SoftwareShader.h"
 
 // TODO: Remove!
 #include <spirv_glsl.hpp>
@@ -41,6 +44,12 @@ namespace Hazel {
 
 			case RendererAPI::API::OpenGL:	
 				return std::make_shared<OpenGLShader>(filepath);
+
+			case RendererAPI::API::Null:
+				return std::make_shared<NullShader>(filepath);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareShader>(filepath);
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
@@ -60,37 +69,228 @@ namespace Hazel {
 
 			case RendererAPI::API::OpenGL:	
 				return std::make_shared<OpenGLShader>(name, vertexSrc, fragmentSrc);
+
+			case RendererAPI::API::Null:
+				return std::make_shared<NullShader>(name, vertexSrc, fragmentSrc);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareShader>(name, vertexSrc, fragmentSrc);
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 		return nullptr;
 	}
 
+	static ShaderDataType SpirvTypeToShaderDataType(const spirv_cross::SPIRType& type)
+	{
+		if (!type.array.empty())
+			return ShaderDataType::None;
+
+		switch (type.basetype)
+		{
+			case spirv_cross::SPIRType::Boolean:
+				return type.vecsize == 1 ? ShaderDataType::Bool : ShaderDataType::None;
+
+			case spirv_cross::SPIRType::UInt:
+				return type.vecsize == 1 ? ShaderDataType::UInt : ShaderDataType::None;
+
+			case spirv_cross::SPIRType::Int:
+				switch (type.vecsize)
+				{
+					case 1: return ShaderDataType::Int;
+					case 2: return ShaderDataType::Int2;
+					case 3: return ShaderDataType::Int3;
+					case 4: return ShaderDataType::Int4;
+				}
+				break;
+
+			case spirv_cross::SPIRType::Float:
+				if (type.columns == 3 && type.vecsize == 3)
+					return ShaderDataType::Mat3;
+				if (type.columns == 4 && type.vecsize == 4)
+					return ShaderDataType::Mat4;
+				if (type.columns != 1)
+					break;
+
+				switch (type.vecsize)
+				{
+					case 1: return ShaderDataType::Float;
+					case 2: return ShaderDataType::Float2;
+					case 3: return ShaderDataType::Float3;
+					case 4: return ShaderDataType::Float4;
+				}
+				break;
+		}
+
+		return ShaderDataType::None;
+	}
+
+	// Blocks and samplers declared by both stages are only added once
+	static void Reflect(const spirv_cross::CompilerGLSL& compiler, bool vertexStage, ShaderReflection& reflection)
+	{
+		spirv_cross::ShaderResources resources = compiler.get_shader_resources();
+
+		if (vertexStage)
+		{
+			for (const auto& input : resources.stage_inputs)
+			{
+				uint32_t location = compiler.get_decoration(input.id, spv::DecorationLocation);
+				reflection.Inputs.push_back({ input.name, location, SpirvTypeToShaderDataType(compiler.get_type(input.type_id)) });
+			}
+		}
+
+		for (const auto& block : resources.uniform_buffers)
+		{
+			const std::string& name = compiler.get_name(block.base_type_id);
+			if (reflection.FindUniformBlock(name))
+				continue;
+
+			uint32_t binding = compiler.get_decoration(block.id, spv::DecorationBinding);
+			uint32_t size = (uint32_t)compiler.get_declared_struct_size(compiler.get_type(block.base_type_id));
+			reflection.UniformBlocks.push_back({ name, binding, size });
+		}
+
+		for (const auto& sampler : resources.sampled_images)
+		{
+			if (reflection.FindSampler(sampler.name))
+				continue;
+
+			const spirv_cross::SPIRType& type = compiler.get_type(sampler.type_id);
+			uint32_t binding = compiler.get_decoration(sampler.id, spv::DecorationBinding);
+
+			// Sized by a specialization constant, array holds the id of the constant then
+			uint32_t arraySize = 1;
+			if (!type.array.empty())
+				arraySize = type.array_size_literal[0] ? type.array[0] : compiler.get_constant(type.array[0]).scalar();
+			reflection.Samplers.push_back({ sampler.name, binding, arraySize });
+		}
+	}
+
+	// Binding points of the engine's uniform blocks, see UniformBuffer. The compiled shaders set
+	// their blocks' bindings from this table, so the SPIR-V doesn't have to agree with it.
+	static const std::pair<const char*, uint32_t> s_UniformBlockBindings[] =
+	{
+		{ "SceneData",  0 },
+		{ "RenderData", 1 }
+	};
+
+	static void AssignUniformBlockBindings(spirv_cross::CompilerGLSL& compiler)
+	{
+		for (const auto& block : compiler.get_shader_resources().uniform_buffers)
+		{
+			const std::string& name = compiler.get_name(block.base_type_id);
+			for (const auto& [blockName, binding] : s_UniformBlockBindings)
+			{
+				if (name == blockName)
+					compiler.set_decoration(block.id, spv::DecorationBinding, binding);
+			}
+		}
+	}
+
+	// Changes the default values of the constants, which is what the GLSL output declares
+	static void Specialize(spirv_cross::CompilerGLSL& compiler, const ShaderSpecialization& specialization)
+	{
+		for (const auto& constant : compiler.get_specialization_constants())
+		{
+			for (const auto& value : specialization)
+			{
+				if (value.Id == constant.constant_id)
+					compiler.get_constant(constant.id).m.c[0].r[0].u32 = value.Value;
+			}
+		}
+	}
+
+	// Part of the cache key of cross-compiled shaders. Bump it when the output changes for the same
+	// inputs, e.g. the GLSL generation or the reflection format.
+	static const uint32_t s_CrossCompileVersion = 1;
+
 	// TODO: Put the implementation inside Platform!
 	Ref<Shader> Shader::CreateFromSpirv(
 		const std::string& name,
 		const std::string& vsPath,
-		const std::string& fsPath
+		const std::string& fsPath,
+		const ShaderSpecialization& specialization
+	) {
+		// Nothing would consume the GLSL, the software rasterizer runs its own fixed program
+		if (Renderer::GetAPI() == RendererAPI::API::Null)
+			return std::make_shared<NullShader>(name, "", "");
+		if (Renderer::GetAPI() == RendererAPI::API::Software)
+			return std::make_shared<SoftwareShader>(name, "", "");
+
+		std::string vsSource, fsSource;
+		ShaderReflection reflection;
+		CrossCompileSpirv(vsPath, fsPath, specialization, vsSource, fsSource, reflection);
+
+		Ref<Shader> shader = Create(name, vsSource, fsSource);
+		shader->SetReflection(std::move(reflection));
+		return shader;
+	}
+
+	void Shader::CrossCompileSpirv(
+		const std::string& vsPath,
+		const std::string& fsPath,
+		const ShaderSpecialization& specialization,
+		std::string& vertexSrc,
+		std::string& fragmentSrc,
+		ShaderReflection& reflection
 	) {
+		HZ_PROFILE_FUNCTION()
+
 		spirv_cross::CompilerGLSL::Options options;
-		options.version = 330;
+		// 4.2+ keeps the explicit binding points, the blocks are backed by UniformBuffers
+		options.version = 450;
 		options.es = false;
-		options.emit_uniform_buffer_as_plain_uniforms = true;
 
 		std::vector<uint32_t> vs = LoadSpirvFile(vsPath);
 		std::vector<uint32_t> fs = LoadSpirvFile(fsPath);
 
+		uint64_t hash = ShaderCache::Hash(&s_CrossCompileVersion, sizeof(s_CrossCompileVersion));
+		hash = ShaderCache::Hash(vs.data(), vs.size() * sizeof(uint32_t), hash);
+		hash = ShaderCache::Hash(fs.data(), fs.size() * sizeof(uint32_t), hash);
+		hash = ShaderCache::Hash(&options.version, sizeof(options.version), hash);
+		hash = ShaderCache::Hash(&options.es, sizeof(options.es), hash);
+		hash = ShaderCache::Hash(specialization.data(), specialization.size() * sizeof(SpecializationConstant), hash);
+		for (const auto& [blockName, binding] : s_UniformBlockBindings)
+		{
+			hash = ShaderCache::Hash(std::string(blockName), hash);
+			hash = ShaderCache::Hash(&binding, sizeof(binding), hash);
+		}
+
+		// Both stages in one entry, separated by a null character. The reflection is stored next to it.
+		std::vector<uint8_t> cached, cachedReflection;
+		if (ShaderCache::Load("glsl", hash, "", cached) && ShaderCache::Load("refl", hash, "", cachedReflection)
+			&& ShaderReflection::Deserialize(cachedReflection, reflection))
+		{
+			const char* text = (const char*)cached.data();
+			size_t vsLength = strnlen(text, cached.size());
+			vertexSrc.assign(text, vsLength);
+			if (vsLength < cached.size())
+				fragmentSrc.assign(text + vsLength + 1, cached.size() - vsLength - 1);
+			return;
+		}
+
 		spirv_cross::CompilerGLSL vsCompiler(std::move(vs));
 		spirv_cross::CompilerGLSL fsCompiler(std::move(fs));
 
+		Specialize(vsCompiler, specialization);
+		Specialize(fsCompiler, specialization);
+		AssignUniformBlockBindings(vsCompiler);
+		AssignUniformBlockBindings(fsCompiler);
+
+		reflection = {};
+		Reflect(vsCompiler, true, reflection);
+		Reflect(fsCompiler, false, reflection);
+		std::vector<uint8_t> reflectionData = reflection.Serialize();
+		ShaderCache::Store("refl", hash, "", reflectionData.data(), reflectionData.size());
+
 		vsCompiler.set_common_options(options);
 		fsCompiler.set_common_options(options);
 
-		std::string vsSource, fsSource;
-		vsSource = vsCompiler.compile();
-		fsSource = fsCompiler.compile();
+		vertexSrc = vsCompiler.compile();
+		fragmentSrc = fsCompiler.compile();
 
-		return Create(name, vsSource, fsSource);
+		std::string entry = vertexSrc + '\0' + fragmentSrc;
+		ShaderCache::Store("glsl", hash, "", entry.data(), entry.size());
 	}
 
 }
\ No newline at end of file
@@ -1,10 +1,42 @@
 #pragma once
 
+#include "Hazel/Renderer/ShaderReflection.h"
+
 #include <string>
 #include <glm/glm.hpp>
 
 namespace Hazel {
 
+	// Uniform name hashed with 32 bit FNV-1a. Literals are hashed at compile time when the id is
+	// constexpr, so ids of per draw uniforms are best kept in static constexpr variables.
+	struct UniformId
+	{
+		uint32_t Hash;
+
+		constexpr UniformId(const char* name) : Hash(HashName(name)) {}
+		UniformId(const std::string& name) : Hash(HashName(name.c_str())) {}
+
+		static constexpr uint32_t HashName(const char* name)
+		{
+			uint32_t hash = 2166136261u;
+			while (*name)
+			{
+				hash ^= (uint8_t)*name++;
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+	};
+
+	// Value for a SPIR-V specialization constant, by its constant_id. Bools are 0 or 1, floats
+	// are passed by bit pattern.
+	struct SpecializationConstant
+	{
+		uint32_t Id;
+		uint32_t Value;
+	};
+	using ShaderSpecialization = std::vector<SpecializationConstant>;
+
 	class HAZEL_API Shader
 	{
 	public:
@@ -13,19 +45,23 @@ namespace Hazel {
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
-		virtual void SetInt(const std::string& name, int value) = 0;
-		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) = 0;
+		virtual void SetInt(UniformId id, int value) = 0;
+		virtual void SetIntArray(UniformId id, int* values, uint32_t count) = 0;
 
-		virtual void SetFloat(const std::string& name, float value) = 0;
-		virtual void SetFloat2(const std::string& name, const glm::vec2& value) = 0;
-		virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
-		virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
+		virtual void SetFloat(UniformId id, float value) = 0;
+		virtual void SetFloat2(UniformId id, const glm::vec2& value) = 0;
+		virtual void SetFloat3(UniformId id, const glm::vec3& value) = 0;
+		virtual void SetFloat4(UniformId id, const glm::vec4& value) = 0;
 
-		virtual void SetMat3(const std::string& name, const glm::mat3& value) = 0;
-		virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
+		virtual void SetMat3(UniformId id, const glm::mat3& value) = 0;
+		virtual void SetMat4(UniformId id, const glm::mat4& value) = 0;
 
 		virtual const std::string& GetName() const = 0;
 
+		// Complete once the shader is ready to draw, backends that link in the background wait here
+		virtual const ShaderReflection& GetReflection() const { return m_Reflection; }
+		void SetReflection(ShaderReflection reflection) { m_Reflection = std::move(reflection); }
+
 		static Ref<Shader> Create(const std::string& filepath);
 
 		static Ref<Shader> Create(
@@ -34,11 +70,28 @@ namespace Hazel {
 			const std::string& fragmentSrc
 		);
 
+		// Every specialization is a separate permutation of the shader. Constants the shader doesn't
+		// declare are ignored.
 		static Ref<Shader> CreateFromSpirv(
 			const std::string& name, 
 			const std::string& vsPath,
-			const std::string& fsPath
+			const std::string& fsPath,
+			const ShaderSpecialization& specialization = {}
 		);
+
+		// The GLSL and reflection CreateFromSpirv produces, without creating the shader. Safe on
+		// any thread.
+		static void CrossCompileSpirv(
+			const std::string& vsPath,
+			const std::string& fsPath,
+			const ShaderSpecialization& specialization,
+			std::string& vertexSrc,
+			std::string& fragmentSrc,
+			ShaderReflection& reflection
+		);
+
+	protected:
+		ShaderReflection m_Reflection;
 	};
 
 }
\ No newline at end of file
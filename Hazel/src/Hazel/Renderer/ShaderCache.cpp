@@ -0,0 +1,143 @@
+#include "hzpch.h"
+#include "ShaderCache.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace Hazel {
+
+	static const uint32_t s_EntryMagic = 0x4353485A; // "HZSC"
+	static const uint32_t s_EntryVersion = 1;
+
+	// Fixed size part of every entry, followed by the tag and the data
+	struct EntryHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t Hash;
+		uint32_t TagSize;
+		uint32_t Padding;
+		uint64_t DataSize;
+	};
+
+	static std::string s_Directory = "assets/cache/shaders";
+	static std::atomic<uint32_t> s_Hits{ 0 }, s_Misses{ 0 };
+
+	static std::string GetEntryPath(const char* kind, uint64_t hash)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "%016llx.", (unsigned long long)hash);
+		return s_Directory + "/" + name + kind;
+	}
+
+	void ShaderCache::SetDirectory(const std::string& directory)
+	{
+		s_Directory = directory;
+	}
+
+	const std::string& ShaderCache::GetDirectory()
+	{
+		return s_Directory;
+	}
+
+	uint64_t ShaderCache::Hash(const void* data, size_t size, uint64_t seed)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		uint64_t hash = seed;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	uint64_t ShaderCache::Hash(const std::string& text, uint64_t seed)
+	{
+		return Hash(text.data(), text.size(), seed);
+	}
+
+	bool ShaderCache::Load(const char* kind, uint64_t hash, const std::string& tag, std::vector<uint8_t>& data)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (s_Directory.empty())
+			return false;
+
+		std::string path = GetEntryPath(kind, hash);
+		std::ifstream in(path, std::ios::in | std::ios::binary);
+		EntryHeader header;
+		if (!in || !in.read((char*)&header, sizeof(header)))
+		{
+			s_Misses++;
+			return false;
+		}
+
+		// Entries from older versions or another tag are overwritten by the next Store
+		std::string entryTag;
+		bool valid = header.Magic == s_EntryMagic && header.Version == s_EntryVersion && header.Hash == hash && header.TagSize == tag.size();
+		if (valid)
+		{
+			entryTag.resize(header.TagSize);
+			valid = in.read(entryTag.data(), entryTag.size()) && entryTag == tag;
+		}
+		if (!valid)
+		{
+			HZ_CORE_TRACE("Ignoring stale shader cache entry '{0}'", path)
+			s_Misses++;
+			return false;
+		}
+
+		data.resize(header.DataSize);
+		if (!in.read((char*)data.data(), data.size()))
+		{
+			HZ_CORE_WARN("Truncated shader cache entry '{0}'", path)
+			s_Misses++;
+			return false;
+		}
+
+		s_Hits++;
+		return true;
+	}
+
+	void ShaderCache::Store(const char* kind, uint64_t hash, const std::string& tag, const void* data, size_t size)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (s_Directory.empty())
+			return;
+
+		std::error_code error;
+		std::filesystem::create_directories(s_Directory, error);
+
+		// Written under a per thread name and moved into place, so a reader never sees half an entry
+		std::string path = GetEntryPath(kind, hash);
+		std::string tempPath = path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+		{
+			std::ofstream out(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			EntryHeader header = { s_EntryMagic, s_EntryVersion, hash, (uint32_t)tag.size(), 0, (uint64_t)size };
+			out.write((const char*)&header, sizeof(header));
+			out.write(tag.data(), tag.size());
+			out.write((const char*)data, size);
+			if (!out)
+			{
+				HZ_CORE_WARN("Could not write shader cache entry '{0}'", path)
+				out.close();
+				std::filesystem::remove(tempPath, error);
+				return;
+			}
+		}
+
+		std::filesystem::rename(tempPath, path, error);
+		if (error)
+			std::filesystem::remove(tempPath, error);
+	}
+
+	ShaderCache::Statistics ShaderCache::GetStats()
+	{
+		return { s_Hits.load(), s_Misses.load() };
+	}
+
+}
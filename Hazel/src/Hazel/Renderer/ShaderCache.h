@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <string>
+#include <vector>
+
+namespace Hazel {
+
+	// On-disk store for data derived from shader sources, such as cross-compiled GLSL and linked
+	// program binaries. Entries are named after the hash of their inputs, and the tag records what
+	// produced them (e.g. the GL driver), so an entry is only used if both still match.
+	class HAZEL_API ShaderCache
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t Hits = 0;
+			uint32_t Misses = 0;
+		};
+
+		// An empty directory disables the cache. Set it before any shader is created.
+		static void SetDirectory(const std::string& directory);
+		static const std::string& GetDirectory();
+
+		// 64 bit FNV-1a, pass the previous result as seed to hash several inputs
+		static constexpr uint64_t HashSeed = 14695981039346656037ull;
+		static uint64_t Hash(const void* data, size_t size, uint64_t seed = HashSeed);
+		static uint64_t Hash(const std::string& text, uint64_t seed = HashSeed);
+
+		// kind is the file extension of the entry, e.g. "glsl"
+		static bool Load(const char* kind, uint64_t hash, const std::string& tag, std::vector<uint8_t>& data);
+		static void Store(const char* kind, uint64_t hash, const std::string& tag, const void* data, size_t size);
+
+		static Statistics GetStats();
+	};
+
+}
@@ -0,0 +1,203 @@
+#include "hzpch.h"
+#include "ShaderLibrary.h"
+
+#include "Renderer.h"
+
+#include "Hazel/Core/ThreadPool.h"
+
+#include <fstream>
+
+namespace Hazel {
+
+	struct ShaderStages
+	{
+		std::string VertexSrc, FragmentSrc;
+		ShaderReflection Reflection;
+	};
+
+	static std::string GetNameFromPath(const std::string& filepath)
+	{
+		auto lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		return filepath.substr(lastSlash, count);
+	}
+
+	// Same format as OpenGLShader::PreProcess, every stage starts with a "#type <stage>" line
+	static ShaderStages ReadStages(const std::string& filepath)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		std::ifstream in(filepath, std::ios::in | std::ios::binary);
+		if (!in)
+		{
+			HZ_CORE_ERROR("Could not open file '{0}'", filepath)
+			return {};
+		}
+		std::string source((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+		ShaderStages stages;
+		const char* typeToken = "#type";
+		size_t typeTokenLength = strlen(typeToken);
+		size_t pos = source.find(typeToken, 0);
+
+		while (pos != std::string::npos)
+		{
+			size_t eol = source.find_first_of("\r\n", pos);
+			HZ_CORE_ASSERT(eol != std::string::npos, "Syntax error")
+			size_t begin = pos + typeTokenLength + 1;
+			std::string type = source.substr(begin, eol - begin);
+
+			size_t nextLinePos = source.find_first_not_of("\r\n", eol);
+			pos = source.find(typeToken, nextLinePos);
+			std::string stage = source.substr(
+				nextLinePos,
+				pos == std::string::npos ? std::string::npos : pos - nextLinePos
+			);
+
+			if (type == "vertex")
+				stages.VertexSrc = std::move(stage);
+			else if (type == "fragment" || type == "pixel")
+				stages.FragmentSrc = std::move(stage);
+			else
+			{
+				HZ_CORE_ASSERT(false, "Unknown shader type!")
+			}
+		}
+
+		return stages;
+	}
+
+	// The part of loading that doesn't touch the renderer, runs on the workers
+	static ShaderStages LoadStages(const ShaderSource& source)
+	{
+		if (!source.Filepath.empty())
+			return ReadStages(source.Filepath);
+
+		// The other backends don't consume GLSL, see Shader::CreateFromSpirv
+		ShaderStages stages;
+		if (Renderer::GetAPI() == RendererAPI::API::OpenGL)
+		{
+			Shader::CrossCompileSpirv(
+				source.VertexPath, source.FragmentPath, source.Specialization,
+				stages.VertexSrc, stages.FragmentSrc, stages.Reflection
+			);
+		}
+		return stages;
+	}
+
+	static Ref<Shader> CreateShader(const ShaderSource& source, const ShaderStages& stages)
+	{
+		if (source.Filepath.empty() && Renderer::GetAPI() != RendererAPI::API::OpenGL)
+			return Shader::CreateFromSpirv(source.Name, source.VertexPath, source.FragmentPath, source.Specialization);
+
+		Ref<Shader> shader = Shader::Create(source.Name, stages.VertexSrc, stages.FragmentSrc);
+		if (!stages.Reflection.IsEmpty())
+			shader->SetReflection(stages.Reflection);
+		return shader;
+	}
+
+	// One pool for every library, so creating a library starts no threads
+	static ThreadPool& GetLoaderPool()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	struct ShaderLibrary::PendingLoads
+	{
+		std::mutex Mutex;
+		std::condition_variable DoneCondition;
+		uint32_t Count = 0;
+	};
+
+	ShaderLibrary::ShaderLibrary()
+		: m_Pending(std::make_shared<PendingLoads>())
+	{
+	}
+
+	ShaderLibrary::~ShaderLibrary()
+	{
+		std::unique_lock lock(m_Pending->Mutex);
+		m_Pending->DoneCondition.wait(lock, [this] { return m_Pending->Count == 0; });
+	}
+
+	std::vector<std::shared_future<Ref<Shader>>> ShaderLibrary::Load(const std::vector<ShaderSource>& sources)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		{
+			std::lock_guard lock(m_Pending->Mutex);
+			m_Pending->Count += (uint32_t)sources.size();
+		}
+
+		std::vector<std::shared_future<Ref<Shader>>> shaders;
+		for (ShaderSource source : sources)
+		{
+			if (source.Name.empty())
+				source.Name = GetNameFromPath(source.Filepath);
+			HZ_CORE_ASSERT(!Exists(source.Name), "Shader already exists!")
+
+			// Deferred, so the shader is created on the thread that asks for it. A failed load
+			// rethrows there.
+			auto promise = std::make_shared<std::promise<ShaderStages>>();
+			std::shared_future<ShaderStages> stages = promise->get_future().share();
+			auto shader = std::async(std::launch::deferred, [source, stages]()
+			{
+				return CreateShader(source, stages.get());
+			}).share();
+
+			m_Shaders[source.Name] = shader;
+			shaders.push_back(shader);
+
+			GetLoaderPool().Submit([source, promise, pending = m_Pending]()
+			{
+				try
+				{
+					promise->set_value(LoadStages(source));
+				}
+				catch (...)
+				{
+					promise->set_exception(std::current_exception());
+				}
+
+				std::lock_guard lock(pending->Mutex);
+				if (--pending->Count == 0)
+					pending->DoneCondition.notify_all();
+			});
+		}
+
+		return shaders;
+	}
+
+	void ShaderLibrary::Add(const Ref<Shader>& shader)
+	{
+		auto& name = shader->GetName();
+		HZ_CORE_ASSERT(!Exists(name), "Shader already exists!")
+
+		std::promise<Ref<Shader>> ready;
+		ready.set_value(shader);
+		m_Shaders[name] = ready.get_future().share();
+	}
+
+	Ref<Shader> ShaderLibrary::Get(const std::string& name)
+	{
+		HZ_CORE_ASSERT(Exists(name), "Shader not found!")
+		return m_Shaders[name].get();
+	}
+
+	bool ShaderLibrary::Exists(const std::string& name) const
+	{
+		return m_Shaders.find(name) != m_Shaders.end();
+	}
+
+	void ShaderLibrary::WaitAll()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		for (auto& kv : m_Shaders)
+			kv.second.get();
+	}
+
+}
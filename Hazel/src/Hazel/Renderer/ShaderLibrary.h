@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+
+#include <future>
+
+namespace Hazel {
+
+	// Either a .glsl file with #type sections or a pair of SPIR-V files
+	struct ShaderSource
+	{
+		std::string Name; // Taken from Filepath if empty
+		std::string Filepath;
+		std::string VertexPath, FragmentPath;
+		ShaderSpecialization Specialization; // SPIR-V only
+	};
+
+	// Named shaders, loaded in parallel. File reads and SPIR-V cross-compilation run on a worker
+	// pool shared by all libraries, the programs are created once their futures are resolved and
+	// then compile and link in the driver without waiting on each other. A batch costs about as
+	// much as its slowest shader.
+	class HAZEL_API ShaderLibrary
+	{
+	public:
+		ShaderLibrary();
+		// Waits for the shaders that are still being read
+		~ShaderLibrary();
+
+		ShaderLibrary(const ShaderLibrary&) = delete;
+		ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+		// Returns right away. The futures create the shader on their first get(), which has to
+		// happen on the main thread like any other renderer call.
+		std::vector<std::shared_future<Ref<Shader>>> Load(const std::vector<ShaderSource>& sources);
+
+		void Add(const Ref<Shader>& shader);
+		// Waits for the shader if it is still loading
+		Ref<Shader> Get(const std::string& name);
+		bool Exists(const std::string& name) const;
+
+		// Creates every shader that is still loading
+		void WaitAll();
+
+	private:
+		// Worker side loads that haven't finished yet
+		struct PendingLoads;
+		std::shared_ptr<PendingLoads> m_Pending;
+
+		std::unordered_map<std::string, std::shared_future<Ref<Shader>>> m_Shaders;
+	};
+
+}
@@ -0,0 +1,180 @@
+#include "hzpch.h"
+#include "ShaderReflection.h"
+
+namespace Hazel {
+
+	static bool IsIntegerInput(ShaderDataType type)
+	{
+		switch (type)
+		{
+			case ShaderDataType::Int:
+			case ShaderDataType::Int2:
+			case ShaderDataType::Int3:
+			case ShaderDataType::Int4:
+			case ShaderDataType::UInt:
+				return true;
+		}
+
+		return false;
+	}
+
+	template<typename T>
+	static const T* FindByName(const std::vector<T>& items, const std::string& name)
+	{
+		for (const auto& item : items)
+		{
+			if (item.Name == name)
+				return &item;
+		}
+		return nullptr;
+	}
+
+	const ShaderReflection::Input* ShaderReflection::FindInput(const std::string& name) const
+	{
+		return FindByName(Inputs, name);
+	}
+
+	const ShaderReflection::UniformBlock* ShaderReflection::FindUniformBlock(const std::string& name) const
+	{
+		return FindByName(UniformBlocks, name);
+	}
+
+	const ShaderReflection::Sampler* ShaderReflection::FindSampler(const std::string& name) const
+	{
+		return FindByName(Samplers, name);
+	}
+
+	void ShaderReflection::ResolveLocations(BufferLayout& layout) const
+	{
+		if (Inputs.empty())
+			return;
+
+		for (auto& element : layout)
+		{
+			const Input* input = FindInput(element.Name);
+			if (!input)
+			{
+				HZ_CORE_WARN("Vertex attribute '{0}' is not an input of the shader", element.Name)
+				continue;
+			}
+
+			HZ_CORE_ASSERT(
+				input->Type != ShaderDataType::None && element.IsInteger() == IsIntegerInput(input->Type),
+				"Vertex attribute type does not match the shader input!"
+			)
+			HZ_CORE_ASSERT(
+				element.GetComponentCount() <= BufferElement(input->Type, input->Name).GetComponentCount(),
+				"Vertex attribute has more components than the shader input!"
+			)
+			element.Location = (int32_t)input->Location;
+		}
+	}
+
+	// Serialized as native 32 bit words, strings prefixed with their length. Only ever read back on
+	// the machine that wrote it, see ShaderCache.
+
+	static void WriteUInt(std::vector<uint8_t>& data, uint32_t value)
+	{
+		const uint8_t* bytes = (const uint8_t*)&value;
+		data.insert(data.end(), bytes, bytes + sizeof(uint32_t));
+	}
+
+	static void WriteString(std::vector<uint8_t>& data, const std::string& value)
+	{
+		WriteUInt(data, (uint32_t)value.size());
+		data.insert(data.end(), value.begin(), value.end());
+	}
+
+	static bool ReadUInt(const std::vector<uint8_t>& data, size_t& offset, uint32_t& value)
+	{
+		if (offset + sizeof(uint32_t) > data.size())
+			return false;
+		memcpy(&value, data.data() + offset, sizeof(uint32_t));
+		offset += sizeof(uint32_t);
+		return true;
+	}
+
+	static bool ReadString(const std::vector<uint8_t>& data, size_t& offset, std::string& value)
+	{
+		uint32_t size;
+		if (!ReadUInt(data, offset, size) || offset + size > data.size())
+			return false;
+		value.assign((const char*)data.data() + offset, size);
+		offset += size;
+		return true;
+	}
+
+	// Guards the resize against corrupt counts, every entry takes at least one word
+	static bool ReadCount(const std::vector<uint8_t>& data, size_t& offset, uint32_t& count)
+	{
+		return ReadUInt(data, offset, count) && count <= (data.size() - offset) / sizeof(uint32_t);
+	}
+
+	std::vector<uint8_t> ShaderReflection::Serialize() const
+	{
+		std::vector<uint8_t> data;
+
+		WriteUInt(data, (uint32_t)Inputs.size());
+		for (const auto& input : Inputs)
+		{
+			WriteString(data, input.Name);
+			WriteUInt(data, input.Location);
+			WriteUInt(data, (uint32_t)input.Type);
+		}
+
+		WriteUInt(data, (uint32_t)UniformBlocks.size());
+		for (const auto& block : UniformBlocks)
+		{
+			WriteString(data, block.Name);
+			WriteUInt(data, block.Binding);
+			WriteUInt(data, block.Size);
+		}
+
+		WriteUInt(data, (uint32_t)Samplers.size());
+		for (const auto& sampler : Samplers)
+		{
+			WriteString(data, sampler.Name);
+			WriteUInt(data, sampler.Binding);
+			WriteUInt(data, sampler.ArraySize);
+		}
+
+		return data;
+	}
+
+	bool ShaderReflection::Deserialize(const std::vector<uint8_t>& data, ShaderReflection& reflection)
+	{
+		size_t offset = 0;
+		uint32_t count, type;
+
+		if (!ReadCount(data, offset, count))
+			return false;
+		reflection.Inputs.resize(count);
+		for (auto& input : reflection.Inputs)
+		{
+			if (!ReadString(data, offset, input.Name) || !ReadUInt(data, offset, input.Location) || !ReadUInt(data, offset, type))
+				return false;
+			input.Type = (ShaderDataType)type;
+		}
+
+		if (!ReadCount(data, offset, count))
+			return false;
+		reflection.UniformBlocks.resize(count);
+		for (auto& block : reflection.UniformBlocks)
+		{
+			if (!ReadString(data, offset, block.Name) || !ReadUInt(data, offset, block.Binding) || !ReadUInt(data, offset, block.Size))
+				return false;
+		}
+
+		if (!ReadCount(data, offset, count))
+			return false;
+		reflection.Samplers.resize(count);
+		for (auto& sampler : reflection.Samplers)
+		{
+			if (!ReadString(data, offset, sampler.Name) || !ReadUInt(data, offset, sampler.Binding) || !ReadUInt(data, offset, sampler.ArraySize))
+				return false;
+		}
+
+		return offset == data.size();
+	}
+
+}
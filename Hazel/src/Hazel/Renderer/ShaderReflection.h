@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Hazel/Renderer/Buffer.h"
+
+#include <string>
+#include <vector>
+
+namespace Hazel {
+
+	// Interface of a shader as declared in its SPIR-V, gathered once when the shader is loaded.
+	// Shaders created from GLSL only have their Inputs, and only after their first Bind.
+	struct ShaderReflection
+	{
+		struct Input
+		{
+			std::string Name;
+			uint32_t Location;
+			ShaderDataType Type; // None for types a BufferElement can't describe
+		};
+
+		struct UniformBlock
+		{
+			std::string Name; // Of the block, e.g. "SceneData"
+			uint32_t Binding;
+			uint32_t Size;
+		};
+
+		struct Sampler
+		{
+			std::string Name;
+			uint32_t Binding;
+			uint32_t ArraySize; // 1 for plain samplers
+		};
+
+		std::vector<Input> Inputs; // Of the vertex stage
+		std::vector<UniformBlock> UniformBlocks;
+		std::vector<Sampler> Samplers;
+
+		bool IsEmpty() const { return Inputs.empty() && UniformBlocks.empty() && Samplers.empty(); }
+
+		const Input* FindInput(const std::string& name) const;
+		const UniformBlock* FindUniformBlock(const std::string& name) const;
+		const Sampler* FindSampler(const std::string& name) const;
+
+		// Gives every element the location of the input with the same name and checks that their
+		// types agree. Elements the shader doesn't declare keep following the previous element.
+		void ResolveLocations(BufferLayout& layout) const;
+
+		std::vector<uint8_t> Serialize() const;
+		static bool Deserialize(const std::vector<uint8_t>& data, ShaderReflection& reflection);
+	};
+
+}
@@ -0,0 +1,225 @@
+#include "hzpch.h"
+#include "SpriteBatch2D.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
+
+#include <glm/gtc/packing.hpp>
+
+namespace Hazel {
+
+	static const uint32_t s_MaxTextureSlots = 32; // Same as Renderer2D, lowered to what the GPU can bind
+
+	// Clean sprites between two dirty ones are uploaded along with them when there are at most
+	// this many, one larger upload is cheaper than two calls
+	static const uint32_t s_MaxUploadGap = 8;
+
+	static const glm::vec2 s_SpriteTexCoords[4] =
+	{
+		{ 0.0f, 0.0f },
+		{ 1.0f, 0.0f },
+		{ 1.0f, 1.0f },
+		{ 0.0f, 1.0f }
+	};
+
+	SpriteBatch2D::SpriteBatch2D(uint32_t maxSprites)
+		: m_MaxSprites(maxSprites)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		static_assert(sizeof(Sprite) == 48, "Sprite does not match the std430 layout of the shader!");
+
+		m_Sprites.reserve(maxSprites);
+		m_Dirty.reserve(maxSprites);
+
+		m_StorageBuffer = StorageBuffer::Create(maxSprites * sizeof(Sprite));
+
+		// Each sprite owns four vertex IDs, the shader derives the sprite and the corner from them
+		m_VertexArray = VertexArray::Create();
+
+		uint32_t indexCount = maxSprites * 6;
+		uint32_t* indices = new uint32_t[indexCount];
+		for (uint32_t i = 0, offset = 0; i < indexCount; i += 6, offset += 4)
+		{
+			indices[i + 0] = offset + 0;
+			indices[i + 1] = offset + 1;
+			indices[i + 2] = offset + 2;
+
+			indices[i + 3] = offset + 2;
+			indices[i + 4] = offset + 3;
+			indices[i + 5] = offset + 0;
+		}
+
+		m_VertexArray->SetIndexBuffer(IndexBuffer::Create(indices, indexCount));
+		delete[] indices;
+	}
+
+	uint32_t SpriteBatch2D::AddSprite(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color)
+	{
+		uint32_t index = AppendSprite();
+		SetSprite(index, position, size, rotation, color);
+		return index;
+	}
+
+	uint32_t SpriteBatch2D::AddSprite(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		float rotation,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec4& tintColor
+	)
+	{
+		uint32_t index = AppendSprite();
+		SetSprite(index, position, size, rotation, texture, tilingFactor, tintColor);
+		return index;
+	}
+
+	uint32_t SpriteBatch2D::AddSprite(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		float rotation,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		uint32_t index = AppendSprite();
+		SetSprite(index, position, size, rotation, subTexture, tintColor);
+		return index;
+	}
+
+	void SpriteBatch2D::SetSprite(uint32_t index, const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color)
+	{
+		WriteSprite(index, position, size, rotation, color, nullptr, 1.0f, s_SpriteTexCoords);
+	}
+
+	void SpriteBatch2D::SetSprite(
+		uint32_t index,
+		const glm::vec3& position,
+		const glm::vec2& size,
+		float rotation,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec4& tintColor
+	)
+	{
+		WriteSprite(index, position, size, rotation, tintColor, texture, tilingFactor, s_SpriteTexCoords);
+	}
+
+	void SpriteBatch2D::SetSprite(
+		uint32_t index,
+		const glm::vec3& position,
+		const glm::vec2& size,
+		float rotation,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		WriteSprite(index, position, size, rotation, tintColor, subTexture->GetTexture(), 1.0f, subTexture->GetTexCoords());
+	}
+
+	void SpriteBatch2D::SetPosition(uint32_t index, const glm::vec3& position, float rotation)
+	{
+		HZ_CORE_ASSERT(index < m_Sprites.size(), "Sprite index out of range!")
+
+		m_Sprites[index].Center = position;
+		m_Sprites[index].Rotation = rotation;
+		MarkDirty(index);
+	}
+
+	void SpriteBatch2D::Clear()
+	{
+		m_Sprites.clear();
+		m_Textures.clear();
+		m_DirtySprites.clear();
+		m_Dirty.clear();
+	}
+
+	uint32_t SpriteBatch2D::Upload()
+	{
+		if (m_DirtySprites.empty())
+			return 0; // Nothing changed
+
+		HZ_PROFILE_FUNCTION()
+
+		std::sort(m_DirtySprites.begin(), m_DirtySprites.end());
+
+		uint32_t bytesUploaded = 0;
+		for (size_t i = 0; i < m_DirtySprites.size();)
+		{
+			// Grow the range while the next dirty sprite is close enough
+			uint32_t begin = m_DirtySprites[i];
+			uint32_t end = begin + 1;
+			for (i++; i < m_DirtySprites.size() && m_DirtySprites[i] - end <= s_MaxUploadGap; i++)
+				end = m_DirtySprites[i] + 1;
+
+			uint32_t size = (end - begin) * sizeof(Sprite);
+			m_StorageBuffer->SetData(&m_Sprites[begin], size, begin * sizeof(Sprite));
+			bytesUploaded += size;
+		}
+
+		for (uint32_t index : m_DirtySprites)
+			m_Dirty[index] = false;
+		m_DirtySprites.clear();
+
+		return bytesUploaded;
+	}
+
+	uint32_t SpriteBatch2D::AppendSprite()
+	{
+		HZ_CORE_ASSERT(m_Sprites.size() < m_MaxSprites, "Sprite batch is full!")
+
+		m_Sprites.emplace_back();
+		m_Dirty.push_back(false);
+		return (uint32_t)m_Sprites.size() - 1;
+	}
+
+	void SpriteBatch2D::WriteSprite(
+		uint32_t index,
+		const glm::vec3& position,
+		const glm::vec2& size,
+		float rotation,
+		const glm::vec4& color,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		HZ_CORE_ASSERT(index < m_Sprites.size(), "Sprite index out of range!")
+
+		uint32_t textureIndex = texture ? GetTextureIndex(texture) : 0; // 0 = white texture
+
+		Sprite& sprite = m_Sprites[index];
+		sprite.Center = position;
+		sprite.Rotation = rotation;
+		sprite.Size = size;
+		sprite.Color = glm::packUnorm4x8(color);
+		sprite.TexIndexTiling = textureIndex | ((uint32_t)glm::packHalf1x16(tilingFactor) << 16);
+		sprite.TexCoordMin = glm::packUnorm2x16(texCoords[0]);
+		sprite.TexCoordMax = glm::packUnorm2x16(texCoords[2]);
+		MarkDirty(index);
+	}
+
+	void SpriteBatch2D::MarkDirty(uint32_t index)
+	{
+		if (m_Dirty[index])
+			return;
+
+		m_Dirty[index] = true;
+		m_DirtySprites.push_back(index);
+	}
+
+	uint32_t SpriteBatch2D::GetTextureIndex(const Ref<Texture2D>& texture)
+	{
+		for (uint32_t i = 0; i < m_Textures.size(); i++)
+		{
+			if (m_Textures[i] == texture)
+				return i + 1;
+		}
+
+		uint32_t maxTextureSlots = std::min(s_MaxTextureSlots, RenderCommand::GetMaxTextureSlots());
+		HZ_CORE_ASSERT(m_Textures.size() + 1 < maxTextureSlots, "Sprite batch is out of texture slots!")
+		m_Textures.push_back(texture);
+		return (uint32_t)m_Textures.size();
+	}
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Hazel/Renderer/VertexArray.h"
+#include "Hazel/Renderer/StorageBuffer.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+
+#include <glm/glm.hpp>
+
+namespace Hazel {
+
+	// Sprites that live in GPU memory across frames as one 48 byte record each in a storage
+	// buffer. There are no vertex attributes: the vertex shader fetches its sprite with
+	// gl_VertexID / 4 and expands the corner itself. Setting a sprite only marks its record, and
+	// the next Renderer2D::DrawSpriteBatch uploads the marked records in as few ranges as possible,
+	// so moving a handful of sprites costs a handful of records. Like StaticBatch2D a batch holds
+	// up to 31 distinct textures.
+	class HAZEL_API SpriteBatch2D
+	{
+	public:
+		SpriteBatch2D(uint32_t maxSprites);
+
+		// Position is the center of the sprite, rotation is in radians. All return the index of
+		// the new sprite, to be passed to SetSprite.
+		uint32_t AddSprite(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
+		uint32_t AddSprite(
+			const glm::vec3& position,
+			const glm::vec2& size,
+			float rotation,
+			const Ref<Texture2D>& texture,
+			float tilingFactor = 1.0f,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+		uint32_t AddSprite(
+			const glm::vec3& position,
+			const glm::vec2& size,
+			float rotation,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		void SetSprite(uint32_t index, const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
+		void SetSprite(
+			uint32_t index,
+			const glm::vec3& position,
+			const glm::vec2& size,
+			float rotation,
+			const Ref<Texture2D>& texture,
+			float tilingFactor = 1.0f,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+		void SetSprite(
+			uint32_t index,
+			const glm::vec3& position,
+			const glm::vec2& size,
+			float rotation,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		// Moves a sprite and keeps everything else
+		void SetPosition(uint32_t index, const glm::vec3& position, float rotation);
+
+		// Removes all sprites and textures
+		void Clear();
+
+		// Uploads the changed sprites, returns the number of bytes uploaded
+		uint32_t Upload();
+
+		inline uint32_t GetSpriteCount() const { return (uint32_t)m_Sprites.size(); }
+		inline const Ref<VertexArray>& GetVertexArray() const { return m_VertexArray; }
+		inline const Ref<StorageBuffer>& GetStorageBuffer() const { return m_StorageBuffer; }
+		inline const std::vector<Ref<Texture2D>>& GetTextures() const { return m_Textures; }
+
+	private:
+		// std430 layout of the Sprite struct in TextureColorSprite.glsl
+		struct Sprite
+		{
+			glm::vec3 Center;
+			float     Rotation;
+			glm::vec2 Size;
+			uint32_t  Color;          // RGBA8, normalized
+			uint32_t  TexIndexTiling; // bits 0-7: texture index, bits 16-31: half float tiling
+			uint32_t  TexCoordMin;    // 16-bit x and y, normalized
+			uint32_t  TexCoordMax;
+			uint32_t  Padding[2];     // Array stride is a multiple of the vec3's 16 byte alignment
+		};
+
+		uint32_t AppendSprite();
+		void WriteSprite(
+			uint32_t index,
+			const glm::vec3& position,
+			const glm::vec2& size,
+			float rotation,
+			const glm::vec4& color,
+			const Ref<Texture2D>& texture,
+			float tilingFactor,
+			const glm::vec2* texCoords
+		);
+		void MarkDirty(uint32_t index);
+		uint32_t GetTextureIndex(const Ref<Texture2D>& texture);
+
+	private:
+		uint32_t m_MaxSprites;
+
+		std::vector<Sprite> m_Sprites;
+		Ref<StorageBuffer> m_StorageBuffer;
+		Ref<VertexArray> m_VertexArray; // Only the index buffer
+
+		std::vector<Ref<Texture2D>> m_Textures; // Bound from slot 1, slot 0 is the white texture
+
+		// Sprites that differ from the GPU copy, m_Dirty is indexed by sprite
+		std::vector<uint32_t> m_DirtySprites;
+		std::vector<bool> m_Dirty;
+	};
+
+}
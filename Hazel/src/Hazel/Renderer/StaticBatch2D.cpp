@@ -0,0 +1,258 @@
+#include "hzpch.h"
+#include "StaticBatch2D.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Hazel {
+
+	static const uint32_t s_MaxTextureSlots = 32; // Same as Renderer2D, lowered to what the GPU can bind
+
+	static const glm::vec4 s_QuadVertexPositions[4] =
+	{
+		{ -0.5f, -0.5f, 0.0f, 1.0f },
+		{  0.5f, -0.5f, 0.0f, 1.0f },
+		{  0.5f,  0.5f, 0.0f, 1.0f },
+		{ -0.5f,  0.5f, 0.0f, 1.0f }
+	};
+
+	static const glm::vec2 s_QuadTexCoords[4] =
+	{
+		{ 0.0f, 0.0f },
+		{ 1.0f, 0.0f },
+		{ 1.0f, 1.0f },
+		{ 0.0f, 1.0f }
+	};
+
+	static void GetQuadPositions(const glm::vec3& position, const glm::vec2& size, glm::vec3* positions)
+	{
+		positions[0] = position;
+		positions[1] = { position.x + size.x, position.y, position.z };
+		positions[2] = { position.x + size.x, position.y + size.y, position.z };
+		positions[3] = { position.x, position.y + size.y, position.z };
+	}
+
+	static void GetQuadPositions(const glm::mat4& transform, glm::vec3* positions)
+	{
+		for (uint32_t i = 0; i < 4; i++)
+			positions[i] = glm::vec3(transform * s_QuadVertexPositions[i]);
+	}
+
+	StaticBatch2D::StaticBatch2D(uint32_t maxQuads)
+		: m_MaxQuads(maxQuads)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		m_Vertices.reserve(maxQuads * 4);
+
+		m_VertexBuffer = VertexBuffer::Create(maxQuads * 4 * sizeof(Vertex));
+		m_VertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::Float4, "a_Color" },
+			{ ShaderDataType::Float2, "a_TexCoord" },
+			{ ShaderDataType::Float,  "a_TexIndex" },
+			{ ShaderDataType::Float,  "a_TilingFactor" }
+		});
+
+		m_VertexArray = VertexArray::Create();
+		m_VertexArray->AddVertexBuffer(m_VertexBuffer);
+
+		uint32_t indexCount = maxQuads * 6;
+		uint32_t* indices = new uint32_t[indexCount];
+		for (uint32_t i = 0, offset = 0; i < indexCount; i += 6, offset += 4)
+		{
+			indices[i + 0] = offset + 0;
+			indices[i + 1] = offset + 1;
+			indices[i + 2] = offset + 2;
+
+			indices[i + 3] = offset + 2;
+			indices[i + 4] = offset + 3;
+			indices[i + 5] = offset + 0;
+		}
+
+		m_VertexArray->SetIndexBuffer(IndexBuffer::Create(indices, indexCount));
+		delete[] indices;
+	}
+
+	uint32_t StaticBatch2D::AddQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		uint32_t index = AppendQuad();
+		SetQuad(index, position, size, color);
+		return index;
+	}
+
+	uint32_t StaticBatch2D::AddQuad(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec4& tintColor
+	)
+	{
+		uint32_t index = AppendQuad();
+		SetQuad(index, position, size, texture, tilingFactor, tintColor);
+		return index;
+	}
+
+	uint32_t StaticBatch2D::AddQuad(
+		const glm::vec3& position,
+		const glm::vec2& size,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		uint32_t index = AppendQuad();
+		SetQuad(index, position, size, subTexture, tintColor);
+		return index;
+	}
+
+	uint32_t StaticBatch2D::AddQuad(const glm::mat4& transform, const glm::vec4& color)
+	{
+		uint32_t index = AppendQuad();
+		SetQuad(index, transform, color);
+		return index;
+	}
+
+	uint32_t StaticBatch2D::AddQuad(
+		const glm::mat4& transform,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec4& tintColor
+	)
+	{
+		uint32_t index = AppendQuad();
+		SetQuad(index, transform, texture, tilingFactor, tintColor);
+		return index;
+	}
+
+	void StaticBatch2D::SetQuad(uint32_t index, const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		glm::vec3 positions[4];
+		GetQuadPositions(position, size, positions);
+		WriteQuad(index, positions, color, nullptr, 1.0f, s_QuadTexCoords);
+	}
+
+	void StaticBatch2D::SetQuad(
+		uint32_t index,
+		const glm::vec3& position,
+		const glm::vec2& size,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec4& tintColor
+	)
+	{
+		glm::vec3 positions[4];
+		GetQuadPositions(position, size, positions);
+		WriteQuad(index, positions, tintColor, texture, tilingFactor, s_QuadTexCoords);
+	}
+
+	void StaticBatch2D::SetQuad(
+		uint32_t index,
+		const glm::vec3& position,
+		const glm::vec2& size,
+		const Ref<SubTexture2D>& subTexture,
+		const glm::vec4& tintColor
+	)
+	{
+		glm::vec3 positions[4];
+		GetQuadPositions(position, size, positions);
+		WriteQuad(index, positions, tintColor, subTexture->GetTexture(), 1.0f, subTexture->GetTexCoords());
+	}
+
+	void StaticBatch2D::SetQuad(uint32_t index, const glm::mat4& transform, const glm::vec4& color)
+	{
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		WriteQuad(index, positions, color, nullptr, 1.0f, s_QuadTexCoords);
+	}
+
+	void StaticBatch2D::SetQuad(
+		uint32_t index,
+		const glm::mat4& transform,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec4& tintColor
+	)
+	{
+		glm::vec3 positions[4];
+		GetQuadPositions(transform, positions);
+		WriteQuad(index, positions, tintColor, texture, tilingFactor, s_QuadTexCoords);
+	}
+
+	void StaticBatch2D::Clear()
+	{
+		m_QuadCount = 0;
+		m_Vertices.clear();
+		m_Textures.clear();
+
+		m_DirtyBegin = UINT32_MAX;
+		m_DirtyEnd = 0;
+	}
+
+	uint32_t StaticBatch2D::Upload()
+	{
+		if (m_DirtyBegin >= m_DirtyEnd)
+			return 0; // Nothing changed
+
+		HZ_PROFILE_FUNCTION()
+
+		uint32_t offset = m_DirtyBegin * 4 * sizeof(Vertex);
+		uint32_t size = (m_DirtyEnd - m_DirtyBegin) * 4 * sizeof(Vertex);
+		m_VertexBuffer->SetData(&m_Vertices[m_DirtyBegin * 4], size, offset);
+
+		m_DirtyBegin = UINT32_MAX;
+		m_DirtyEnd = 0;
+		return size;
+	}
+
+	uint32_t StaticBatch2D::AppendQuad()
+	{
+		HZ_CORE_ASSERT(m_QuadCount < m_MaxQuads, "Static batch is full!")
+
+		m_Vertices.resize(m_Vertices.size() + 4);
+		return m_QuadCount++;
+	}
+
+	void StaticBatch2D::WriteQuad(
+		uint32_t index,
+		const glm::vec3* positions,
+		const glm::vec4& color,
+		const Ref<Texture2D>& texture,
+		float tilingFactor,
+		const glm::vec2* texCoords
+	)
+	{
+		HZ_CORE_ASSERT(index < m_QuadCount, "Quad index out of range!")
+
+		float textureIndex = texture ? GetTextureIndex(texture) : 0.0f; // 0 = white texture
+
+		Vertex* vertex = &m_Vertices[index * 4];
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			vertex[i].Position = positions[i];
+			vertex[i].Color = color;
+			vertex[i].TexCoord = texCoords[i];
+			vertex[i].TexIndex = textureIndex;
+			vertex[i].TilingFactor = tilingFactor;
+		}
+
+		m_DirtyBegin = std::min(m_DirtyBegin, index);
+		m_DirtyEnd = std::max(m_DirtyEnd, index + 1);
+	}
+
+	float StaticBatch2D::GetTextureIndex(const Ref<Texture2D>& texture)
+	{
+		for (uint32_t i = 0; i < m_Textures.size(); i++)
+		{
+			if (m_Textures[i] == texture)
+				return (float)(i + 1);
+		}
+
+		uint32_t maxTextureSlots = std::min(s_MaxTextureSlots, RenderCommand::GetMaxTextureSlots());
+		HZ_CORE_ASSERT(m_Textures.size() + 1 < maxTextureSlots, "Static batch is out of texture slots!")
+		m_Textures.push_back(texture);
+		return (float)m_Textures.size();
+	}
+
+}
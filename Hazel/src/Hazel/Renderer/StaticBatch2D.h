@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Hazel/Renderer/VertexArray.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+
+#include <glm/glm.hpp>
+
+namespace Hazel {
+
+	// Quads that are built once and kept in their own GPU vertex buffer, so they cost no per
+	// frame submission. Edited quads are re-uploaded as a single dirty range the next time the
+	// batch is drawn with Renderer2D::DrawStaticBatch. A batch holds up to 31 distinct textures,
+	// pack more into a TextureAtlas.
+	class HAZEL_API StaticBatch2D
+	{
+	public:
+		StaticBatch2D(uint32_t maxQuads);
+
+		// All return the index of the new quad, to be passed to SetQuad
+		uint32_t AddQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+		uint32_t AddQuad(
+			const glm::vec3& position,
+			const glm::vec2& size,
+			const Ref<Texture2D>& texture,
+			float tilingFactor = 1.0f,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+		uint32_t AddQuad(
+			const glm::vec3& position,
+			const glm::vec2& size,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		// Transformed unit quad centered on the origin
+		uint32_t AddQuad(const glm::mat4& transform, const glm::vec4& color);
+		uint32_t AddQuad(
+			const glm::mat4& transform,
+			const Ref<Texture2D>& texture,
+			float tilingFactor = 1.0f,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		void SetQuad(uint32_t index, const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+		void SetQuad(
+			uint32_t index,
+			const glm::vec3& position,
+			const glm::vec2& size,
+			const Ref<Texture2D>& texture,
+			float tilingFactor = 1.0f,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+		void SetQuad(
+			uint32_t index,
+			const glm::vec3& position,
+			const glm::vec2& size,
+			const Ref<SubTexture2D>& subTexture,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+		void SetQuad(uint32_t index, const glm::mat4& transform, const glm::vec4& color);
+		void SetQuad(
+			uint32_t index,
+			const glm::mat4& transform,
+			const Ref<Texture2D>& texture,
+			float tilingFactor = 1.0f,
+			const glm::vec4& tintColor = glm::vec4(1.0f)
+		);
+
+		// Removes all quads and textures
+		void Clear();
+
+		// Uploads the dirty range, returns the number of bytes uploaded
+		uint32_t Upload();
+
+		inline uint32_t GetQuadCount() const { return m_QuadCount; }
+		inline const Ref<VertexArray>& GetVertexArray() const { return m_VertexArray; }
+		inline const std::vector<Ref<Texture2D>>& GetTextures() const { return m_Textures; }
+
+	private:
+		struct Vertex
+		{
+			glm::vec3 Position;
+			glm::vec4 Color;
+			glm::vec2 TexCoord;
+			float     TexIndex;
+			float     TilingFactor;
+		};
+
+		uint32_t AppendQuad();
+		void WriteQuad(
+			uint32_t index,
+			const glm::vec3* positions,
+			const glm::vec4& color,
+			const Ref<Texture2D>& texture,
+			float tilingFactor,
+			const glm::vec2* texCoords
+		);
+		float GetTextureIndex(const Ref<Texture2D>& texture);
+
+	private:
+		uint32_t m_MaxQuads;
+		uint32_t m_QuadCount = 0;
+
+		std::vector<Vertex> m_Vertices;
+		Ref<VertexBuffer> m_VertexBuffer;
+		Ref<VertexArray> m_VertexArray;
+
+		std::vector<Ref<Texture2D>> m_Textures; // Bound from slot 1, slot 0 is the white texture
+
+		// Quads [m_DirtyBegin, m_DirtyEnd) differ from the GPU copy
+		uint32_t m_DirtyBegin = UINT32_MAX, m_DirtyEnd = 0;
+	};
+
+}
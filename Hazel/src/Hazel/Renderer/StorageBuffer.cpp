@@ -0,0 +1,35 @@
+#include "hzpch.h"
+#include "StorageBuffer.h"
+
+#include "Renderer.h"
+
+#include "Platform/OpenGL/OpenGLStorageBuffer.h"
+#include "Platform/Null/NullStorageBuffer.h"
+#include "Platform/Software/SoftwareStorageBuffer.h"
+
+namespace Hazel {
+
+	Ref<StorageBuffer> StorageBuffer::Create(uint32_t size)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!")
+				return nullptr;
+
+			case RendererAPI::API::OpenGL:
+				return std::make_shared<OpenGLStorageBuffer>(size);
+
+			case RendererAPI::API::Null:
+				return std::make_shared<NullStorageBuffer>(size);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareStorageBuffer>(size);
+
+			default:
+				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
+				return nullptr;
+		}
+	}
+
+}
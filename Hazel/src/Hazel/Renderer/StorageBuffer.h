@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+namespace Hazel {
+
+	// Shader storage buffer, read by shaders that declare a buffer block at the bound binding
+	// point. Unlike a UniformBuffer it can be as large as the GPU allows and the shader indexes
+	// it freely, see SpriteBatch2D.
+	class HAZEL_API StorageBuffer
+	{
+	public:
+		virtual ~StorageBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+		virtual void Bind(uint32_t binding) const = 0;
+
+		virtual uint32_t GetSize() const = 0;
+
+		static Ref<StorageBuffer> Create(uint32_t size);
+	};
+
+}
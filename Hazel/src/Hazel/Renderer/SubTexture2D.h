@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+#include <glm/glm.hpp>
+
+namespace Hazel {
+
+	// Rectangular region of a texture, e.g. a sprite packed into a TextureAtlas page
+	class HAZEL_API SubTexture2D
+	{
+	public:
+		// min and max are normalized texture coordinates
+		SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max);
+
+		inline const Ref<Texture2D>& GetTexture() const { return m_Texture; }
+
+		// Corners in the same order as Renderer2D quads: bottom left, bottom right, top right, top left
+		inline const glm::vec2* GetTexCoords() const { return m_TexCoords; }
+
+	private:
+		Ref<Texture2D> m_Texture;
+		glm::vec2 m_TexCoords[4];
+	};
+
+}
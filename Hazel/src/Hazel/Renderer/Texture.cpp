@@ -4,9 +4,37 @@
 #include "Renderer.h"
 
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Null/NullTexture.h"
+#include "Platform/Software/SoftwareTexture.h"
+
+#include <mutex>
 
 namespace Hazel {
 
+	static std::mutex s_TextureHandleMutex;
+	static std::vector<uint32_t> s_FreeTextureHandles;
+	static uint32_t s_NextTextureHandle = 0;
+
+	Texture::Texture()
+	{
+		std::lock_guard lock(s_TextureHandleMutex);
+		if (s_FreeTextureHandles.empty())
+		{
+			m_Handle = s_NextTextureHandle++;
+		}
+		else
+		{
+			m_Handle = s_FreeTextureHandles.back();
+			s_FreeTextureHandles.pop_back();
+		}
+	}
+
+	Texture::~Texture()
+	{
+		std::lock_guard lock(s_TextureHandleMutex);
+		s_FreeTextureHandles.push_back(m_Handle);
+	}
+
 	Ref<Texture2D> Texture2D::Create(const std::string& path)
 	{
 		switch (Renderer::GetAPI())
@@ -18,6 +46,12 @@ namespace Hazel {
 			case RendererAPI::API::OpenGL:
 				return std::make_shared<OpenGLTexture2D>(path);
 
+			case RendererAPI::API::Null:
+				return std::make_shared<NullTexture2D>(path);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareTexture2D>(path);
+
 			default:
 				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 				return nullptr;
@@ -45,6 +79,12 @@ namespace Hazel {
 			case RendererAPI::API::OpenGL:
 				return std::make_shared<OpenGLTexture2D>(data, width, height, channels);
 
+			case RendererAPI::API::Null:
+				return std::make_shared<NullTexture2D>(data, width, height, channels);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareTexture2D>(data, width, height, channels);
+
 			default:
 				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 				return nullptr;
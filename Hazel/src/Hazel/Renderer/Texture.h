@@ -9,17 +9,33 @@ namespace Hazel {
 	class HAZEL_API Texture
 	{
 	public:
-		virtual ~Texture() = default;
+		virtual ~Texture();
 
 		virtual void Bind(uint32_t slot = 0) const = 0;
 
 		virtual void SetData(void* data, uint32_t size) = 0;
 
+		// Updates a region of the texture, data must be in the texture's own format
+		virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
 
+		// Whether the texture has an alpha channel, regardless of the actual pixel values
+		virtual bool HasAlpha() const = 0;
+
+		// Small integer that is unique among live textures and reused after they are destroyed,
+		// so renderers can index tables with it instead of comparing textures
+		inline uint32_t GetHandle() const { return m_Handle; }
+
 	public:
 		virtual bool operator==(const Texture& other) const = 0;
+
+	protected:
+		Texture();
+
+	private:
+		uint32_t m_Handle;
 	};
 
 	class HAZEL_API Texture2D : public Texture
@@ -0,0 +1,185 @@
+#include "hzpch.h"
+#include "TextureAtlas.h"
+
+#include "stb_image.h"
+
+namespace Hazel {
+
+	// Every image is surrounded by a copy of its edge pixels, so linear filtering at the border
+	// of a sprite never picks up its neighbours
+	static const uint32_t s_Padding = 1;
+
+	TextureAtlas::TextureAtlas(uint32_t pageWidth, uint32_t pageHeight)
+		: m_PageWidth(pageWidth), m_PageHeight(pageHeight)
+	{
+	}
+
+	Ref<SubTexture2D> TextureAtlas::Add(const std::string& path)
+	{
+		HZ_PROFILE_FUNCTION()
+		stbi_set_flip_vertically_on_load(true);
+
+		int width, height, channels;
+		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+		HZ_CORE_ASSERT(data, "Failed to load image!")
+
+		Ref<SubTexture2D> subTexture = Add(data, width, height, channels);
+
+		stbi_image_free(data);
+		return subTexture;
+	}
+
+	Ref<SubTexture2D> TextureAtlas::Add(const void* data, uint32_t width, uint32_t height, uint32_t channels)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(channels == 3 || channels == 4, "Format not supported!")
+
+		uint32_t paddedWidth = width + 2 * s_Padding;
+		uint32_t paddedHeight = height + 2 * s_Padding;
+		if (paddedWidth > m_PageWidth || paddedHeight > m_PageHeight)
+		{
+			HZ_CORE_ASSERT(false, "Image does not fit in an atlas page!")
+			return nullptr;
+		}
+
+		// Convert to RGBA and extrude the edges into the padding
+		std::vector<uint32_t> pixels(paddedWidth * paddedHeight);
+		const uint8_t* source = (const uint8_t*)data;
+		for (uint32_t y = 0; y < paddedHeight; y++)
+		{
+			uint32_t sourceY = std::min(std::max(y, s_Padding) - s_Padding, height - 1);
+			for (uint32_t x = 0; x < paddedWidth; x++)
+			{
+				uint32_t sourceX = std::min(std::max(x, s_Padding) - s_Padding, width - 1);
+				const uint8_t* pixel = source + (sourceY * width + sourceX) * channels;
+				uint32_t alpha = channels == 4 ? pixel[3] : 0xFF;
+				pixels[y * paddedWidth + x] = pixel[0] | pixel[1] << 8 | pixel[2] << 16 | alpha << 24;
+			}
+		}
+
+		// Earlier pages may still have room for small images
+		uint32_t x = 0, y = 0;
+		size_t node = 0;
+		Page* page = nullptr;
+		for (auto& candidate : m_Pages)
+		{
+			if (FindPosition(candidate, paddedWidth, paddedHeight, x, y, node))
+			{
+				page = &candidate;
+				break;
+			}
+		}
+
+		if (!page)
+		{
+			AddPage();
+			page = &m_Pages.back();
+			bool found = FindPosition(*page, paddedWidth, paddedHeight, x, y, node);
+			HZ_CORE_ASSERT(found, "Image does not fit in an empty atlas page!")
+		}
+
+		AddSkylineLevel(*page, node, x, y, paddedWidth, paddedHeight);
+		page->Texture->SetSubData(pixels.data(), x, y, paddedWidth, paddedHeight);
+
+		glm::vec2 pageSize = { (float)m_PageWidth, (float)m_PageHeight };
+		glm::vec2 min = glm::vec2(x + s_Padding, y + s_Padding) / pageSize;
+		glm::vec2 max = glm::vec2(x + s_Padding + width, y + s_Padding + height) / pageSize;
+		return std::make_shared<SubTexture2D>(page->Texture, min, max);
+	}
+
+	void TextureAtlas::AddPage()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		// Start out transparent, the gaps between images are never written
+		std::vector<uint32_t> clear(m_PageWidth * m_PageHeight, 0);
+
+		Page page;
+		page.Texture = Texture2D::Create(clear.data(), m_PageWidth, m_PageHeight, 4);
+		page.Skyline.push_back({ 0, 0, m_PageWidth });
+		m_Pages.push_back(page);
+	}
+
+	// Bottom-left heuristic: lowest resulting top edge, ties go to the narrowest node
+	bool TextureAtlas::FindPosition(
+		const Page& page,
+		uint32_t width,
+		uint32_t height,
+		uint32_t& x,
+		uint32_t& y,
+		size_t& node
+	) const
+	{
+		uint32_t bestTop = UINT32_MAX, bestWidth = UINT32_MAX;
+
+		for (size_t i = 0; i < page.Skyline.size(); i++)
+		{
+			uint32_t left = page.Skyline[i].X;
+			if (left + width > m_PageWidth)
+				break; // Nodes are sorted by X, so no later node fits either
+
+			// The image rests on the highest node it spans
+			uint32_t top = 0;
+			uint32_t remaining = width;
+			for (size_t j = i; remaining > 0; j++)
+			{
+				top = std::max(top, page.Skyline[j].Y);
+				remaining -= std::min(remaining, page.Skyline[j].Width);
+			}
+
+			if (top + height > m_PageHeight)
+				continue;
+
+			if (top + height < bestTop || (top + height == bestTop && page.Skyline[i].Width < bestWidth))
+			{
+				bestTop = top + height;
+				bestWidth = page.Skyline[i].Width;
+				x = left;
+				y = top;
+				node = i;
+			}
+		}
+
+		return bestTop != UINT32_MAX;
+	}
+
+	void TextureAtlas::AddSkylineLevel(Page& page, size_t node, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		auto& skyline = page.Skyline;
+		skyline.insert(skyline.begin() + node, { x, y + height, width });
+
+		// Trim or remove the nodes now covered by the new one
+		for (size_t i = node + 1; i < skyline.size(); )
+		{
+			uint32_t right = skyline[i - 1].X + skyline[i - 1].Width;
+			if (skyline[i].X >= right)
+				break;
+
+			uint32_t overlap = right - skyline[i].X;
+			if (skyline[i].Width <= overlap)
+			{
+				skyline.erase(skyline.begin() + i);
+				continue;
+			}
+
+			skyline[i].X += overlap;
+			skyline[i].Width -= overlap;
+			break;
+		}
+
+		// Merge neighbours at the same height
+		for (size_t i = 0; i + 1 < skyline.size(); )
+		{
+			if (skyline[i].Y == skyline[i + 1].Y)
+			{
+				skyline[i].Width += skyline[i + 1].Width;
+				skyline.erase(skyline.begin() + i + 1);
+			}
+			else
+			{
+				i++;
+			}
+		}
+	}
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Hazel/Renderer/SubTexture2D.h"
+
+#include <string>
+#include <vector>
+
+namespace Hazel {
+
+	// Packs images at runtime into large RGBA pages with a bottom-left skyline packer, so sprites
+	// from many images can share the same texture slot in a batch. A new page is started when an
+	// image does not fit in any of the existing ones.
+	class HAZEL_API TextureAtlas
+	{
+	public:
+		TextureAtlas(uint32_t pageWidth = 2048, uint32_t pageHeight = 2048);
+
+		Ref<SubTexture2D> Add(const std::string& path);
+
+		// data holds width * height pixels with 3 (RGB) or 4 (RGBA) channels of 8 bits
+		Ref<SubTexture2D> Add(const void* data, uint32_t width, uint32_t height, uint32_t channels = 4);
+
+		inline uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+
+	private:
+		// Top of the packed area over [X, X + Width)
+		struct SkylineNode
+		{
+			uint32_t X, Y, Width;
+		};
+
+		struct Page
+		{
+			Ref<Texture2D> Texture;
+			std::vector<SkylineNode> Skyline; // Sorted by X, covers the full page width
+		};
+
+		void AddPage();
+
+		bool FindPosition(const Page& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y, size_t& node) const;
+		void AddSkylineLevel(Page& page, size_t node, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+	private:
+		uint32_t m_PageWidth, m_PageHeight;
+		std::vector<Page> m_Pages;
+	};
+
+}
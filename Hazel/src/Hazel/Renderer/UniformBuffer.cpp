@@ -0,0 +1,35 @@
+#include "hzpch.h"
+#include "UniformBuffer.h"
+
+#include "Renderer.h"
+
+#include "Platform/OpenGL/OpenGLUniformBuffer.h"
+#include "Platform/Null/NullUniformBuffer.h"
+#include "Platform/Software/SoftwareUniformBuffer.h"
+
+namespace Hazel {
+
+	Ref<UniformBuffer> UniformBuffer::Create(uint32_t size)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:
+				HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!")
+				return nullptr;
+
+			case RendererAPI::API::OpenGL:
+				return std::make_shared<OpenGLUniformBuffer>(size);
+
+			case RendererAPI::API::Null:
+				return std::make_shared<NullUniformBuffer>(size);
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareUniformBuffer>(size);
+
+			default:
+				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
+				return nullptr;
+		}
+	}
+
+}
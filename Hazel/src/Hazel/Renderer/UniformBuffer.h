@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+namespace Hazel {
+
+	// Shader constants shared by every shader that declares a uniform block at the bound binding
+	// point. The engine's shaders declare SceneData at binding 0 and RenderData at binding 1.
+	class HAZEL_API UniformBuffer
+	{
+	public:
+		virtual ~UniformBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+		// Binds the whole buffer
+		virtual void Bind(uint32_t binding) const = 0;
+		// Binds size bytes at offset, offset must be a multiple of GetOffsetAlignment()
+		virtual void BindRange(uint32_t binding, uint32_t offset, uint32_t size) const = 0;
+
+		virtual uint32_t GetSize() const = 0;
+		virtual uint32_t GetOffsetAlignment() const = 0;
+
+		static Ref<UniformBuffer> Create(uint32_t size);
+	};
+
+}
@@ -4,6 +4,8 @@
 #include "Renderer.h"
 
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Null/NullVertexArray.h"
+#include "Platform/Software/SoftwareVertexArray.h"
 
 namespace Hazel {
 
@@ -18,6 +20,12 @@ namespace Hazel {
 			case RendererAPI::API::OpenGL:
 				return std::make_shared<OpenGLVertexArray>();
 
+			case RendererAPI::API::Null:
+				return std::make_shared<NullVertexArray>();
+
+			case RendererAPI::API::Software:
+				return std::make_shared<SoftwareVertexArray>();
+
 			default:
 				HZ_CORE_ASSERT(false, "Unknown RendererAPI!")
 				return nullptr;
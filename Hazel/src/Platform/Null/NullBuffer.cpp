@@ -0,0 +1,68 @@
+#include "hzpch.h"
+#include "NullBuffer.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel {
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// VertexBuffer ///////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	NullVertexBuffer::NullVertexBuffer(uint32_t size)
+		: m_Size(size)
+	{
+	}
+
+	NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size)
+		: m_Size(size)
+	{
+		SetData(vertices, size);
+	}
+
+	void NullVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= m_Size, "Data does not fit into the buffer!")
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.BufferUploads++;
+		counters.BytesUploaded += size;
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// StreamingVertexBuffer //////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	NullStreamingVertexBuffer::NullStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount)
+		: m_Data(regionSize * regionCount),
+		  m_RegionSize(regionSize),
+		  m_RegionCount(regionCount),
+		  m_RegionIndex(regionCount - 1)
+	{
+	}
+
+	void NullStreamingVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= m_RegionSize, "Data does not fit into a region!")
+		memcpy(m_Data.data() + GetRegionOffset() + offset, data, size);
+	}
+
+	void* NullStreamingVertexBuffer::BeginRegion()
+	{
+		m_RegionIndex = (m_RegionIndex + 1) % m_RegionCount;
+		return m_Data.data() + GetRegionOffset();
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// IndexBuffer ////////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+		: m_Count(count)
+	{
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.BufferUploads++;
+		counters.BytesUploaded += count * sizeof(uint32_t);
+	}
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Hazel/Renderer/Buffer.h"
+
+namespace Hazel {
+
+	class HAZEL_API NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullVertexBuffer(uint32_t size);
+		NullVertexBuffer(float* vertices, uint32_t size);
+		virtual ~NullVertexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+	private:
+		uint32_t m_Size;
+		BufferLayout m_Layout;
+	};
+
+	// Regions live in plain memory, since there is no GPU to wait for
+	class HAZEL_API NullStreamingVertexBuffer : public StreamingVertexBuffer
+	{
+	public:
+		NullStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+		virtual ~NullStreamingVertexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void* BeginRegion() override;
+		virtual void EndRegion() override {}
+
+		virtual uint32_t GetRegionOffset() const override { return m_RegionIndex * m_RegionSize; }
+		virtual uint32_t GetRegionSize() const override { return m_RegionSize; }
+
+	private:
+		BufferLayout m_Layout;
+
+		std::vector<uint8_t> m_Data;
+		uint32_t m_RegionSize;
+		uint32_t m_RegionCount;
+		uint32_t m_RegionIndex;
+	};
+
+	class HAZEL_API NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer(uint32_t* indices, uint32_t count);
+		virtual ~NullIndexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual uint32_t GetCount() const override { return m_Count; }
+
+	private:
+		uint32_t m_Count;
+	};
+
+}
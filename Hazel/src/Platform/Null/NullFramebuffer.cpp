@@ -0,0 +1,16 @@
+#include "hzpch.h"
+#include "NullFramebuffer.h"
+
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel {
+
+	NullFramebuffer::NullFramebuffer(FramebufferType type, uint32_t width, uint32_t height)
+		: m_Type(type), m_Width(width), m_Height(height)
+	{
+		// Same attachments as OpenGLFramebuffer, renderbuffers are not exposed
+		if (type == FramebufferType::Texture2D)
+			m_Buffers.push_back(Texture2D::Create(nullptr, width, height));
+	}
+
+}
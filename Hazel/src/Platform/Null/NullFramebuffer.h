@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Hazel/Renderer/Framebuffer.h"
+
+namespace Hazel {
+
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+		NullFramebuffer(FramebufferType type, uint32_t width, uint32_t height);
+		virtual ~NullFramebuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void BlitTo(const Framebuffer* const framebuffer) const override {}
+
+		inline virtual const std::shared_ptr<Texture2D>& GetBuffer(int index) const override
+		{
+			return m_Buffers[index];
+		}
+
+	private:
+		FramebufferType m_Type;
+		uint32_t m_Width, m_Height;
+		std::vector<std::shared_ptr<Texture2D>> m_Buffers;
+	};
+
+}
@@ -0,0 +1,88 @@
+#include "hzpch.h"
+#include "NullRendererAPI.h"
+
+namespace Hazel {
+
+	static NullRendererCounters s_Counters;
+
+	void NullRendererAPI::Init()
+	{
+	}
+
+	void NullRendererAPI::SetClearColor(const glm::vec4& color)
+	{
+	}
+
+	void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+	}
+
+	void NullRendererAPI::Clear()
+	{
+		s_Counters.Clears++;
+	}
+
+	void NullRendererAPI::DrawIndexed(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t indexCount,
+		uint32_t baseVertex,
+		uint32_t firstIndex
+	)
+	{
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+
+		s_Counters.DrawCalls++;
+		s_Counters.IndicesDrawn += count;
+	}
+
+	void NullRendererAPI::DrawArraysInstanced(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t vertexCount,
+		uint32_t instanceCount,
+		uint32_t baseInstance
+	)
+	{
+		s_Counters.DrawCalls++;
+		s_Counters.VerticesDrawn += (uint64_t)vertexCount * instanceCount;
+		s_Counters.InstancesDrawn += instanceCount;
+	}
+
+	void NullRendererAPI::DrawIndexedInstanced(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t instanceCount,
+		uint32_t baseInstance,
+		uint32_t indexCount
+	)
+	{
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+
+		s_Counters.DrawCalls++;
+		s_Counters.IndicesDrawn += (uint64_t)count * instanceCount;
+		s_Counters.InstancesDrawn += instanceCount;
+	}
+
+	void NullRendererAPI::DrawIndexedIndirect(
+		const Ref<VertexArray>& vertexArray,
+		const DrawIndexedIndirectCommand* commands,
+		uint32_t count
+	)
+	{
+		s_Counters.DrawCalls++;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			s_Counters.IndicesDrawn += (uint64_t)commands[i].Count * commands[i].InstanceCount;
+			s_Counters.InstancesDrawn += commands[i].InstanceCount;
+		}
+	}
+
+	NullRendererCounters& NullRendererAPI::GetCounters()
+	{
+		return s_Counters;
+	}
+
+	void NullRendererAPI::ResetCounters()
+	{
+		s_Counters = NullRendererCounters();
+	}
+
+}
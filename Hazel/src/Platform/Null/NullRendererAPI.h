@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Hazel/Renderer/RendererAPI.h>
+
+namespace Hazel {
+
+	// Work recorded by the Null backend objects in place of GPU calls
+	struct NullRendererCounters
+	{
+		uint64_t DrawCalls = 0;
+		uint64_t IndicesDrawn = 0;
+		uint64_t VerticesDrawn = 0;  // Non-indexed draws, per instance
+		uint64_t InstancesDrawn = 0;
+		uint64_t Clears = 0;
+
+		uint64_t BufferUploads = 0;
+		uint64_t TextureUploads = 0;
+		uint64_t BytesUploaded = 0;
+
+		uint64_t ShaderBinds = 0;
+		uint64_t VertexArrayBinds = 0;
+		uint64_t TextureBinds = 0;
+		uint64_t UniformUploads = 0;
+	};
+
+	// Backend without a GPU: every call is a no-op that only updates the counters, so everything
+	// above the graphics API can run and be profiled on machines without a GL context
+	class HAZEL_API NullRendererAPI : public RendererAPI
+	{
+	public:
+		virtual void Init() override;
+
+		virtual void SetClearColor(const glm::vec4& color) override;
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+		virtual void Clear() override;
+		virtual void DrawIndexed(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t indexCount = 0,
+			uint32_t baseVertex = 0,
+			uint32_t firstIndex = 0
+		) override;
+		virtual void DrawArraysInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t vertexCount,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0
+		) override;
+		virtual void DrawIndexedInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0,
+			uint32_t indexCount = 0
+		) override;
+		virtual void DrawIndexedIndirect(
+			const Ref<VertexArray>& vertexArray,
+			const DrawIndexedIndirectCommand* commands,
+			uint32_t count
+		) override;
+
+		// Typical desktop GPU, so Renderer2D batches the same as with OpenGL
+		virtual uint32_t GetMaxTextureSlots() const override { return 32; }
+
+		// Nothing is bound, see NullRendererCounters
+		virtual BindStatistics GetBindStats() const override { return {}; }
+		virtual void ResetBindStats() override {}
+
+		static NullRendererCounters& GetCounters();
+		static void ResetCounters();
+	};
+
+}
@@ -0,0 +1,71 @@
+#include "hzpch.h"
+#include "NullShader.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel {
+
+	NullShader::NullShader(const std::string& filepath)
+	{
+		// Extract name from filepath
+		auto lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		m_Name = filepath.substr(lastSlash, count);
+	}
+
+	NullShader::NullShader(
+		const std::string& name,
+		const std::string& vertexSrc,
+		const std::string& fragmentSrc
+	) : m_Name(name)
+	{
+	}
+
+	void NullShader::Bind() const
+	{
+		NullRendererAPI::GetCounters().ShaderBinds++;
+	}
+
+	void NullShader::SetInt(UniformId id, int value)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+	void NullShader::SetIntArray(UniformId id, int* values, uint32_t count)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+	void NullShader::SetFloat(UniformId id, float value)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+	void NullShader::SetFloat2(UniformId id, const glm::vec2& value)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+	void NullShader::SetFloat3(UniformId id, const glm::vec3& value)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+	void NullShader::SetFloat4(UniformId id, const glm::vec4& value)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+	void NullShader::SetMat3(UniformId id, const glm::mat3& value)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+	void NullShader::SetMat4(UniformId id, const glm::mat4& value)
+	{
+		NullRendererAPI::GetCounters().UniformUploads++;
+	}
+
+}
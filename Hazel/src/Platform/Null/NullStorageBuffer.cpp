@@ -0,0 +1,22 @@
+#include "hzpch.h"
+#include "NullStorageBuffer.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel {
+
+	NullStorageBuffer::NullStorageBuffer(uint32_t size)
+		: m_Size(size)
+	{
+	}
+
+	void NullStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= m_Size, "Data does not fit into the buffer!")
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.BufferUploads++;
+		counters.BytesUploaded += size;
+	}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Hazel/Renderer/StorageBuffer.h"
+
+namespace Hazel {
+
+	class HAZEL_API NullStorageBuffer : public StorageBuffer
+	{
+	public:
+		NullStorageBuffer(uint32_t size);
+		virtual ~NullStorageBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void Bind(uint32_t binding) const override {}
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+
+	private:
+		uint32_t m_Size;
+	};
+
+}
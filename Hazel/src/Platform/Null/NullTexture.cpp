@@ -0,0 +1,58 @@
+#include "hzpch.h"
+#include "NullTexture.h"
+
+#include "NullRendererAPI.h"
+
+#include "stb_image.h"
+
+namespace Hazel {
+
+	NullTexture2D::NullTexture2D(const std::string& path)
+		: m_Path(path), m_Width(0), m_Height(0), m_Channels(0)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		// Only the header is read, the image is never decoded
+		int width, height, channels;
+		int result = stbi_info(path.c_str(), &width, &height, &channels);
+		HZ_CORE_ASSERT(result, "Failed to load image!")
+
+		m_Width = width;
+		m_Height = height;
+		m_Channels = channels;
+	}
+
+	NullTexture2D::NullTexture2D(
+		const void* data,
+		uint32_t width,
+		uint32_t height,
+		uint32_t channels
+	) : m_Path(""), m_Width(width), m_Height(height), m_Channels(channels)
+	{
+		HZ_CORE_ASSERT(channels == 3 || channels == 4, "Format not supported!")
+	}
+
+	void NullTexture2D::Bind(uint32_t slot) const
+	{
+		NullRendererAPI::GetCounters().TextureBinds++;
+	}
+
+	void NullTexture2D::SetData(void* data, uint32_t size)
+	{
+		HZ_CORE_ASSERT(size == m_Width * m_Height * m_Channels, "Data must be entire texture!")
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.TextureUploads++;
+		counters.BytesUploaded += size;
+	}
+
+	void NullTexture2D::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		HZ_CORE_ASSERT(x + width <= m_Width && y + height <= m_Height, "Region must be inside the texture!")
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.TextureUploads++;
+		counters.BytesUploaded += width * height * m_Channels;
+	}
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel {
+
+	// Keeps the size and format of the image, but not its pixels
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		NullTexture2D(const std::string& path);
+		NullTexture2D(const void* data, uint32_t width, uint32_t height, uint32_t channels);
+		virtual ~NullTexture2D() = default;
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual void SetData(void* data, uint32_t size) override;
+		virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+
+		virtual bool HasAlpha() const override { return m_Channels == 4; }
+
+	public:
+		bool operator==(const Texture& other) const override
+		{
+			return GetHandle() == other.GetHandle();
+		}
+
+	private:
+		std::string m_Path;
+		uint32_t m_Width, m_Height, m_Channels;
+	};
+
+}
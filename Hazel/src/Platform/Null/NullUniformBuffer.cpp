@@ -0,0 +1,22 @@
+#include "hzpch.h"
+#include "NullUniformBuffer.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel {
+
+	NullUniformBuffer::NullUniformBuffer(uint32_t size)
+		: m_Size(size)
+	{
+	}
+
+	void NullUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= m_Size, "Data does not fit into the buffer!")
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.BufferUploads++;
+		counters.BytesUploaded += size;
+	}
+
+}
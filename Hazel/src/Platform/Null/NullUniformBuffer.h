@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Hazel/Renderer/UniformBuffer.h"
+
+namespace Hazel {
+
+	class HAZEL_API NullUniformBuffer : public UniformBuffer
+	{
+	public:
+		NullUniformBuffer(uint32_t size);
+		virtual ~NullUniformBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void Bind(uint32_t binding) const override {}
+		virtual void BindRange(uint32_t binding, uint32_t offset, uint32_t size) const override {}
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+		virtual uint32_t GetOffsetAlignment() const override { return 1; }
+
+	private:
+		uint32_t m_Size;
+	};
+
+}
@@ -0,0 +1,24 @@
+#include "hzpch.h"
+#include "NullVertexArray.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel {
+
+	void NullVertexArray::Bind() const
+	{
+		NullRendererAPI::GetCounters().VertexArrayBinds++;
+	}
+
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!")
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+	{
+		m_IndexBuffer = indexBuffer;
+	}
+
+}
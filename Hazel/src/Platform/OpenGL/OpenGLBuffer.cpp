@@ -1,5 +1,8 @@
 #include "hzpch.h"
 #include "OpenGLBuffer.h"
+#include "OpenGLState.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
 
 #include <glad/glad.h>
 
@@ -13,43 +16,158 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION()
 		
-		glCreateBuffers(1, &m_RendererId);
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererId);
-		glBufferData(GL_ARRAY_BUFFER, size * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+		RenderCommand::SubmitAndWait([this, size]()
+		{
+			glCreateBuffers(1, &m_RendererId);
+			OpenGLState::Get().BindBuffer(GL_ARRAY_BUFFER, m_RendererId);
+			glBufferData(GL_ARRAY_BUFFER, size * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+		});
 	}
 
 	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
 	{
 		HZ_PROFILE_FUNCTION()
 		
-		glCreateBuffers(1, &m_RendererId);
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererId);
-		glBufferData(GL_ARRAY_BUFFER, size * sizeof(float), vertices, GL_STATIC_DRAW);
+		RenderCommand::SubmitAndWait([this, vertices, size]()
+		{
+			glCreateBuffers(1, &m_RendererId);
+			OpenGLState::Get().BindBuffer(GL_ARRAY_BUFFER, m_RendererId);
+			glBufferData(GL_ARRAY_BUFFER, size * sizeof(float), vertices, GL_STATIC_DRAW);
+		});
 	}
 
 	OpenGLVertexBuffer::~OpenGLVertexBuffer()
 	{
 		HZ_PROFILE_FUNCTION()
-		glDeleteBuffers(1, &m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]()
+		{
+			OpenGLState::Get().OnDeleteBuffer(rendererId);
+			glDeleteBuffers(1, &rendererId);
+		});
 	}
 
 	void OpenGLVertexBuffer::Bind() const
 	{
 		HZ_PROFILE_FUNCTION()
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]() { OpenGLState::Get().BindBuffer(GL_ARRAY_BUFFER, rendererId); });
 	}
 
 	void OpenGLVertexBuffer::Unbind() const
 	{
 		HZ_PROFILE_FUNCTION()
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		RenderCommand::Submit([]() { OpenGLState::Get().BindBuffer(GL_ARRAY_BUFFER, 0); });
+	}
+
+	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		data = RenderCommand::CopyData(data, size);
+		RenderCommand::Submit([rendererId = m_RendererId, data, size, offset]()
+		{
+			OpenGLState::Get().BindBuffer(GL_ARRAY_BUFFER, rendererId);
+			glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+		});
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// StreamingVertexBuffer //////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	static const GLbitfield s_StreamingMapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount)
+		: m_RegionSize(regionSize), m_RegionIndex(regionCount - 1), m_Fences(regionCount, nullptr)
+	{
+		HZ_PROFILE_FUNCTION()
+		// The region fences are waited on by the recording thread
+		HZ_CORE_ASSERT(!RenderCommand::IsThreaded(), "Streaming vertex buffers need the context on the calling thread!")
+
+		uint32_t size = regionSize * regionCount;
+
+		glCreateBuffers(1, &m_RendererId);
+		glNamedBufferStorage(m_RendererId, size, nullptr, s_StreamingMapFlags);
+		m_MappedData = (uint8_t*)glMapNamedBufferRange(m_RendererId, 0, size, s_StreamingMapFlags);
+
+		HZ_CORE_ASSERT(m_MappedData, "Failed to map streaming vertex buffer!")
+	}
+
+	OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		for (void* fence : m_Fences)
+		{
+			if (fence)
+				glDeleteSync((GLsync)fence);
+		}
+
+		glUnmapNamedBuffer(m_RendererId);
+		OpenGLState::Get().OnDeleteBuffer(m_RendererId);
+		glDeleteBuffers(1, &m_RendererId);
+	}
+
+	void OpenGLStreamingVertexBuffer::Bind() const
+	{
+		HZ_PROFILE_FUNCTION()
+		OpenGLState::Get().BindBuffer(GL_ARRAY_BUFFER, m_RendererId);
+	}
+
+	void OpenGLStreamingVertexBuffer::Unbind() const
+	{
+		HZ_PROFILE_FUNCTION()
+		OpenGLState::Get().BindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
-	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
+	// offset is relative to the current region
+	void OpenGLStreamingVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
 	{
 		HZ_PROFILE_FUNCTION()
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererId);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+		HZ_CORE_ASSERT(offset + size <= m_RegionSize, "Data does not fit into a region!")
+		memcpy(m_MappedData + GetRegionOffset() + offset, data, size);
+	}
+
+	void* OpenGLStreamingVertexBuffer::BeginRegion()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		m_RegionIndex = (m_RegionIndex + 1) % (uint32_t)m_Fences.size();
+
+		GLsync fence = (GLsync)m_Fences[m_RegionIndex];
+		if (fence)
+		{
+			// Only flush on the first wait, the fence has been submitted after that
+			GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+			while (true)
+			{
+				GLenum result = glClientWaitSync(fence, flags, 1000000); // 1ms
+				if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+					break;
+
+				if (result == GL_WAIT_FAILED)
+				{
+					HZ_CORE_ASSERT(false, "glClientWaitSync failed!")
+					break;
+				}
+
+				flags = 0;
+			}
+
+			glDeleteSync(fence);
+			m_Fences[m_RegionIndex] = nullptr;
+		}
+
+		return m_MappedData + GetRegionOffset();
+	}
+
+	void OpenGLStreamingVertexBuffer::EndRegion()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (m_Fences[m_RegionIndex])
+			glDeleteSync((GLsync)m_Fences[m_RegionIndex]);
+
+		m_Fences[m_RegionIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 	}
 
 	///////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,27 +179,34 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION()
 		
-		glCreateBuffers(1, &m_RendererId);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererId);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		// Binding GL_ELEMENT_ARRAY_BUFFER would modify whichever vertex array the render thread has bound
+		RenderCommand::SubmitAndWait([this, indices, count]()
+		{
+			glCreateBuffers(1, &m_RendererId);
+			glNamedBufferData(m_RendererId, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		});
 	}
 
 	OpenGLIndexBuffer::~OpenGLIndexBuffer()
 	{
 		HZ_PROFILE_FUNCTION()
-		glDeleteBuffers(1, &m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]()
+		{
+			OpenGLState::Get().OnDeleteBuffer(rendererId);
+			glDeleteBuffers(1, &rendererId);
+		});
 	}
 
 	void OpenGLIndexBuffer::Bind() const
 	{
 		HZ_PROFILE_FUNCTION()
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]() { OpenGLState::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, rendererId); });
 	}
 
 	void OpenGLIndexBuffer::Unbind() const
 	{
 		HZ_PROFILE_FUNCTION()
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		RenderCommand::Submit([]() { OpenGLState::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); });
 	}
 
 }
\ No newline at end of file
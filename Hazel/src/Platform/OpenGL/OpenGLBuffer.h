@@ -17,13 +17,44 @@ namespace Hazel {
 		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
 		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 
-		virtual void SetData(const void* data, uint32_t size) override;
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
 
 	private:
 		uint32_t m_RendererId;
 		BufferLayout m_Layout;
 	};
 
+	class HAZEL_API OpenGLStreamingVertexBuffer : public StreamingVertexBuffer
+	{
+	public:
+		OpenGLStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+		virtual ~OpenGLStreamingVertexBuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		// Copies into the current region
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void* BeginRegion() override;
+		virtual void EndRegion() override;
+
+		virtual uint32_t GetRegionOffset() const override { return m_RegionIndex * m_RegionSize; }
+		virtual uint32_t GetRegionSize() const override { return m_RegionSize; }
+
+	private:
+		uint32_t m_RendererId;
+		BufferLayout m_Layout;
+
+		uint8_t* m_MappedData;
+		uint32_t m_RegionSize;
+		uint32_t m_RegionIndex;
+		std::vector<void*> m_Fences; // GLsync per region, null when the region is free
+	};
+
 	class HAZEL_API OpenGLIndexBuffer : public IndexBuffer
 	{
 	public:
@@ -16,6 +16,7 @@ namespace Hazel {
 	void OpenGLContext::Init()
 	{
 		glfwMakeContextCurrent(m_Window);
+		OpenGLState::SetCurrent(&m_State);
 		int status = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
 		HZ_CORE_ASSERT(status, "Failed to initialize GLAD")
 
@@ -23,6 +24,18 @@ namespace Hazel {
 		HZ_CORE_INFO("  Vendor: {0}", glGetString(GL_VENDOR))
 		HZ_CORE_INFO("  Renderer: {0}", glGetString(GL_RENDERER))
 		HZ_CORE_INFO("  Version: {0}", glGetString(GL_VERSION))
+
+		// Lets the driver compile and link on its own threads, OpenGLShader only waits for the
+		// link status when a program is first used
+		typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSPROC)(GLuint count);
+		PFNGLMAXSHADERCOMPILERTHREADSPROC maxShaderCompilerThreads = nullptr;
+		if (glfwExtensionSupported("GL_KHR_parallel_shader_compile"))
+			maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+		else if (glfwExtensionSupported("GL_ARB_parallel_shader_compile"))
+			maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+		if (maxShaderCompilerThreads)
+			maxShaderCompilerThreads(0xFFFFFFFF); // As many as the driver likes
+		HZ_CORE_INFO("  Parallel shader compile: {0}", maxShaderCompilerThreads ? "yes" : "no")
 	}
 
 	void OpenGLContext::SwapBuffers()
@@ -30,4 +43,16 @@ namespace Hazel {
 		glfwSwapBuffers(m_Window);
 	}
 
+	void OpenGLContext::MakeCurrent()
+	{
+		glfwMakeContextCurrent(m_Window);
+		OpenGLState::SetCurrent(&m_State);
+	}
+
+	void OpenGLContext::ReleaseCurrent()
+	{
+		glfwMakeContextCurrent(nullptr);
+		OpenGLState::SetCurrent(nullptr);
+	}
+
 }
\ No newline at end of file
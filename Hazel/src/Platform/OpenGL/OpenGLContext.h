@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Hazel/Renderer/GraphicsContext.h"
+#include "Platform/OpenGL/OpenGLState.h"
 
 struct GLFWwindow;
 
@@ -14,8 +15,12 @@ namespace Hazel {
 		virtual void Init() override;
 		virtual void SwapBuffers() override;
 
+		virtual void MakeCurrent() override;
+		virtual void ReleaseCurrent() override;
+
 	private:
 		GLFWwindow* m_Window;
+		OpenGLState m_State;
 	};
 
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "hzpch.h"
 #include "OpenGLFramebuffer.h"
 
+#include "Hazel/Renderer/RenderCommand.h"
 #include "Hazel/Renderer/Texture.h"
 
 #include "OpenGLTexture.h"
@@ -13,60 +14,64 @@ namespace Hazel {
 	OpenGLFramebuffer::OpenGLFramebuffer(FramebufferType type, uint32_t width, uint32_t height)
 		: m_RendererId(0), m_Type(type), m_Width(width), m_Height(height)
 	{
-		glGenFramebuffers(1, &m_RendererId);
-		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererId);
-
-		switch (type)
+		// Runs on the render thread as a whole, the color texture is created there directly
+		RenderCommand::SubmitAndWait([this, type, width, height]()
 		{
-			case FramebufferType::Texture2D:
-			{
-				auto tex = Texture2D::Create(nullptr, width, height);
-				auto ogltex = std::dynamic_pointer_cast<OpenGLTexture2D>(tex);
+			glGenFramebuffers(1, &m_RendererId);
+			glBindFramebuffer(GL_FRAMEBUFFER, m_RendererId);
 
-				if (ogltex == nullptr)
+			switch (type)
+			{
+				case FramebufferType::Texture2D:
 				{
-					HZ_CORE_ASSERT(true, "Texture2D is not compatible!")
-					return;
-				}
+					auto tex = Texture2D::Create(nullptr, width, height);
+					auto ogltex = std::dynamic_pointer_cast<OpenGLTexture2D>(tex);
 
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, ogltex->GetId(), 0);
-				m_Buffers.push_back(tex);
-			} break;
+					if (ogltex == nullptr)
+					{
+						HZ_CORE_ASSERT(true, "Texture2D is not compatible!")
+						return;
+					}
 
-			case FramebufferType::Renderbuffer:
-			{
-				uint32_t rbo;
-				glGenRenderbuffers(1, &rbo);
-				glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-				glRenderbufferStorageMultisample(GL_RENDERBUFFER, 8, GL_RGB, width, height);
-				glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rbo);
-			} break;
-
-			default:
-				HZ_CORE_ASSERT(false, "Unknown Framebuffer type!")
-		}
+					glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, ogltex->GetId(), 0);
+					m_Buffers.push_back(tex);
+				} break;
 
-		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
-		{
-			HZ_CORE_ASSERT(false, "Failed to create Framebuffer!")
-		}
+				case FramebufferType::Renderbuffer:
+				{
+					uint32_t rbo;
+					glGenRenderbuffers(1, &rbo);
+					glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+					glRenderbufferStorageMultisample(GL_RENDERBUFFER, 8, GL_RGB, width, height);
+					glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rbo);
+				} break;
+
+				default:
+					HZ_CORE_ASSERT(false, "Unknown Framebuffer type!")
+			}
+
+			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			{
+				HZ_CORE_ASSERT(false, "Failed to create Framebuffer!")
+			}
 
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		});
 	}
 
 	OpenGLFramebuffer::~OpenGLFramebuffer()
 	{
-		glDeleteFramebuffers(1, &m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]() { glDeleteFramebuffers(1, &rendererId); });
 	}
 
 	void OpenGLFramebuffer::Bind() const
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]() { glBindFramebuffer(GL_FRAMEBUFFER, rendererId); });
 	}
 
 	void OpenGLFramebuffer::Unbind() const
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		RenderCommand::Submit([]() { glBindFramebuffer(GL_FRAMEBUFFER, 0); });
 	}
 
 	void OpenGLFramebuffer::BlitTo(const Framebuffer* const framebuffer) const
@@ -79,14 +84,20 @@ namespace Hazel {
 			return;
 		}
 
-		glBindFramebuffer(GL_READ_FRAMEBUFFER, m_RendererId);
-		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, glFb->m_RendererId);
-		glBlitFramebuffer(
-			0, 0, m_Width, m_Height,
-			0, 0, glFb->m_Width, glFb->m_Height,
-			GL_COLOR_BUFFER_BIT, GL_NEAREST
-		);
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		RenderCommand::Submit([
+			src = m_RendererId, srcWidth = m_Width, srcHeight = m_Height,
+			dst = glFb->m_RendererId, dstWidth = glFb->m_Width, dstHeight = glFb->m_Height
+		]()
+		{
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, src);
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dst);
+			glBlitFramebuffer(
+				0, 0, srcWidth, srcHeight,
+				0, 0, dstWidth, dstHeight,
+				GL_COLOR_BUFFER_BIT, GL_NEAREST
+			);
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		});
 	}
 
 }
\ No newline at end of file
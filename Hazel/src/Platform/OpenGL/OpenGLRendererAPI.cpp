@@ -1,16 +1,34 @@
 #include "hzpch.h"
 #include "OpenGLRendererAPI.h"
+#include "OpenGLState.h"
 
 #include <glad/glad.h>
 
 namespace Hazel {
 
+	OpenGLRendererAPI::~OpenGLRendererAPI()
+	{
+		if (m_IndirectBuffer)
+		{
+			OpenGLState::Get().OnDeleteBuffer(m_IndirectBuffer);
+			glDeleteBuffers(1, &m_IndirectBuffer);
+		}
+	}
+
 	void OpenGLRendererAPI::Init()
 	{
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		OpenGLState& state = OpenGLState::Get();
+		state.SetBlend(true);
+		state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+		state.SetDepthTest(true);
 
-		glEnable(GL_DEPTH_TEST);
+		GLint maxTextureSlots = 0;
+		glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureSlots);
+		m_MaxTextureSlots = (uint32_t)maxTextureSlots;
+
+		glCreateBuffers(1, &m_IndirectBuffer);
+		glNamedBufferData(m_IndirectBuffer, IndirectBufferCapacity * sizeof(DrawIndexedIndirectCommand), nullptr, GL_DYNAMIC_DRAW);
 	}
 
 	void OpenGLRendererAPI::SetClearColor(const glm::vec4& color)
@@ -28,10 +46,83 @@ namespace Hazel {
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	}
 
-	void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount)
+	void OpenGLRendererAPI::DrawIndexed(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t indexCount,
+		uint32_t baseVertex,
+		uint32_t firstIndex
+	)
 	{
 		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
-		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+		const void* offset = (const void*)(firstIndex * sizeof(uint32_t));
+		if (baseVertex)
+			glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, offset, baseVertex);
+		else
+			glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, offset);
+	}
+
+	void OpenGLRendererAPI::DrawArraysInstanced(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t vertexCount,
+		uint32_t instanceCount,
+		uint32_t baseInstance
+	)
+	{
+		if (baseInstance)
+			glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, vertexCount, instanceCount, baseInstance);
+		else
+			glDrawArraysInstanced(GL_TRIANGLES, 0, vertexCount, instanceCount);
+	}
+
+	void OpenGLRendererAPI::DrawIndexedInstanced(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t instanceCount,
+		uint32_t baseInstance,
+		uint32_t indexCount
+	)
+	{
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		if (baseInstance)
+			glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount, baseInstance);
+		else
+			glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount);
+	}
+
+	void OpenGLRendererAPI::DrawIndexedIndirect(
+		const Ref<VertexArray>& vertexArray,
+		const DrawIndexedIndirectCommand* commands,
+		uint32_t count
+	)
+	{
+		OpenGLState::Get().BindBuffer(GL_DRAW_INDIRECT_BUFFER, m_IndirectBuffer);
+
+		while (count > 0)
+		{
+			uint32_t drawCount = std::min(count, IndirectBufferCapacity);
+
+			// Wrap around once the ring is full
+			if (m_IndirectOffset + drawCount > IndirectBufferCapacity)
+				m_IndirectOffset = 0;
+
+			size_t offset = m_IndirectOffset * sizeof(DrawIndexedIndirectCommand);
+			glNamedBufferSubData(m_IndirectBuffer, offset, drawCount * sizeof(DrawIndexedIndirectCommand), commands);
+			glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)offset, drawCount, 0);
+
+			m_IndirectOffset += drawCount;
+			commands += drawCount;
+			count -= drawCount;
+		}
+	}
+
+	BindStatistics OpenGLRendererAPI::GetBindStats() const
+	{
+		OpenGLState::Statistics stats = OpenGLState::GetStats();
+		return { stats.Binds, stats.SkippedBinds };
+	}
+
+	void OpenGLRendererAPI::ResetBindStats()
+	{
+		OpenGLState::ResetStats();
 	}
 
 }
\ No newline at end of file
@@ -7,13 +7,51 @@ namespace Hazel {
 	class HAZEL_API OpenGLRendererAPI : public RendererAPI
 	{
 	public:
+		virtual ~OpenGLRendererAPI();
+
 		virtual void Init() override;
 
 		virtual void SetClearColor(const glm::vec4& color) override;
 		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
 		virtual void Clear() override;
-		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+		virtual void DrawIndexed(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t indexCount = 0,
+			uint32_t baseVertex = 0,
+			uint32_t firstIndex = 0
+		) override;
+		virtual void DrawArraysInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t vertexCount,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0
+		) override;
+		virtual void DrawIndexedInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0,
+			uint32_t indexCount = 0
+		) override;
+		virtual void DrawIndexedIndirect(
+			const Ref<VertexArray>& vertexArray,
+			const DrawIndexedIndirectCommand* commands,
+			uint32_t count
+		) override;
+
+		virtual uint32_t GetMaxTextureSlots() const override { return m_MaxTextureSlots; }
+
+		virtual BindStatistics GetBindStats() const override;
+		virtual void ResetBindStats() override;
+
+	private:
+		static const uint32_t IndirectBufferCapacity = 4096; // Commands, 80 KB
+
+		uint32_t m_MaxTextureSlots = 0;
+
+		// Ring the commands of DrawIndexedIndirect are streamed through
+		uint32_t m_IndirectBuffer = 0;
+		uint32_t m_IndirectOffset = 0; // In commands
 	};
 
 }
\ No newline at end of file
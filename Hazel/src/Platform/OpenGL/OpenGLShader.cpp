@@ -1,5 +1,9 @@
 #include "hzpch.h"
 #include "OpenGLShader.h"
+#include "OpenGLState.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/ShaderCache.h"
 
 #include <fstream>
 #include <glad/glad.h>
@@ -18,13 +22,52 @@ namespace Hazel {
 		return 0;
 	}
 
+	static ShaderDataType GLTypeToShaderDataType(GLenum type)
+	{
+		switch (type)
+		{
+			case GL_FLOAT:             return ShaderDataType::Float;
+			case GL_FLOAT_VEC2:        return ShaderDataType::Float2;
+			case GL_FLOAT_VEC3:        return ShaderDataType::Float3;
+			case GL_FLOAT_VEC4:        return ShaderDataType::Float4;
+			case GL_INT:               return ShaderDataType::Int;
+			case GL_INT_VEC2:          return ShaderDataType::Int2;
+			case GL_INT_VEC3:          return ShaderDataType::Int3;
+			case GL_INT_VEC4:          return ShaderDataType::Int4;
+			case GL_UNSIGNED_INT:      return ShaderDataType::UInt;
+			case GL_FLOAT_MAT3:        return ShaderDataType::Mat3;
+			case GL_FLOAT_MAT4:        return ShaderDataType::Mat4;
+		}
+
+		return ShaderDataType::None;
+	}
+
+	// Program binaries are only valid for the driver that produced them
+	static const std::string& GetDriverString()
+	{
+		static const std::string driver = [] {
+			GLint formatCount = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+			if (formatCount == 0)
+				return std::string();
+
+			std::string result = (const char*)glGetString(GL_VENDOR);
+			result += '|';
+			result += (const char*)glGetString(GL_RENDERER);
+			result += '|';
+			result += (const char*)glGetString(GL_VERSION);
+			return result;
+		}();
+		return driver;
+	}
+
 	OpenGLShader::OpenGLShader(const std::string& filepath)
 	{
 		HZ_PROFILE_FUNCTION()
 		
 		std::string source = ReadFile(filepath);
 		auto shaderSrcs = PreProcess(source);
-		Compile(shaderSrcs);
+		RenderCommand::SubmitAndWait([&]() { Compile(shaderSrcs); });
 
 		// Extract name from filepath
 		auto lastSlash = filepath.find_last_of("/\\");
@@ -47,121 +90,157 @@ namespace Hazel {
 			{ GL_VERTEX_SHADER,   vertexSrc   },
 			{ GL_FRAGMENT_SHADER, fragmentSrc }
 		};
-		Compile(shaderSrcs);
+		RenderCommand::SubmitAndWait([&]() { Compile(shaderSrcs); });
 	}
 
 	OpenGLShader::~OpenGLShader()
 	{
 		HZ_PROFILE_FUNCTION()
-		glDeleteProgram(m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId, shaderIds = m_ShaderIds]()
+		{
+			// Shaders are still around if the program was never used
+			for (auto shaderId : shaderIds)
+				glDeleteShader(shaderId);
+
+			OpenGLState::Get().OnDeleteProgram(rendererId);
+			glDeleteProgram(rendererId);
+		});
 	}
 
 	void OpenGLShader::Bind() const
 	{
 		HZ_PROFILE_FUNCTION()
-		glUseProgram(m_RendererId);
+		WaitUntilLinked();
+		RenderCommand::Submit([rendererId = m_RendererId]() { OpenGLState::Get().UseProgram(rendererId); });
 	}
 
 	void OpenGLShader::Unbind() const
 	{
 		HZ_PROFILE_FUNCTION()
-		glUseProgram(0);
+		RenderCommand::Submit([]() { OpenGLState::Get().UseProgram(0); });
 	}
 
-	void OpenGLShader::SetInt(const std::string& name, int value)
+	void OpenGLShader::SetInt(UniformId id, int value)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformInt(name, value);
+		UploadUniformInt(id, value);
 	}
 
-	void OpenGLShader::SetIntArray(const std::string& name, int* values, uint32_t count)
+	void OpenGLShader::SetIntArray(UniformId id, int* values, uint32_t count)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformIntArray(name, values, count);
+		UploadUniformIntArray(id, values, count);
 	}
 
-	void OpenGLShader::SetFloat(const std::string& name, float value)
+	void OpenGLShader::SetFloat(UniformId id, float value)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformFloat(name, value);
+		UploadUniformFloat(id, value);
 	}
 
-	void OpenGLShader::SetFloat2(const std::string& name, const glm::vec2& value)
+	void OpenGLShader::SetFloat2(UniformId id, const glm::vec2& value)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformFloat2(name, value);
+		UploadUniformFloat2(id, value);
 	}
 
-	void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& value)
+	void OpenGLShader::SetFloat3(UniformId id, const glm::vec3& value)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformFloat3(name, value);
+		UploadUniformFloat3(id, value);
 	}
 
-	void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& value)
+	void OpenGLShader::SetFloat4(UniformId id, const glm::vec4& value)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformFloat4(name, value);
+		UploadUniformFloat4(id, value);
 	}
 
-	void OpenGLShader::SetMat3(const std::string& name, const glm::mat3& value)
+	void OpenGLShader::SetMat3(UniformId id, const glm::mat3& value)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformMat3(name, value);
+		UploadUniformMat3(id, value);
 	}
 
-	void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value)
+	void OpenGLShader::SetMat4(UniformId id, const glm::mat4& value)
 	{
 		HZ_PROFILE_FUNCTION()
-		UploadUniformMat4(name, value);
+		UploadUniformMat4(id, value);
+	}
+
+	void OpenGLShader::UploadUniformInt(UniformId id, int value) const
+	{
+		GLint location = GetUniformLocation(id);
+		if (location >= 0)
+			RenderCommand::Submit([location, value]() { glUniform1i(location, value); });
 	}
 
-	void OpenGLShader::UploadUniformInt(const std::string& name, int value) const
+	void OpenGLShader::UploadUniformIntArray(UniformId id, int* values, uint32_t count) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniform1i(location, value);
+		GLint location = GetUniformLocation(id);
+		if (location < 0)
+			return;
+
+		const void* data = RenderCommand::CopyData(values, count * sizeof(int));
+		RenderCommand::Submit([location, data, count]() { glUniform1iv(location, count, (const GLint*)data); });
 	}
 
-	void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count) const
+	void OpenGLShader::UploadUniformFloat(UniformId id, float value) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniform1iv(location, count, values);
+		GLint location = GetUniformLocation(id);
+		if (location >= 0)
+			RenderCommand::Submit([location, value]() { glUniform1f(location, value); });
 	}
 
-	void OpenGLShader::UploadUniformFloat(const std::string& name, float value) const
+	void OpenGLShader::UploadUniformFloat2(UniformId id, const glm::vec2& value) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniform1f(location, value);
+		GLint location = GetUniformLocation(id);
+		if (location >= 0)
+			RenderCommand::Submit([location, value]() { glUniform2f(location, value.x, value.y); });
 	}
 
-	void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2& value) const
+	void OpenGLShader::UploadUniformFloat3(UniformId id, const glm::vec3& value) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniform2f(location, value.x, value.y);
+		GLint location = GetUniformLocation(id);
+		if (location >= 0)
+			RenderCommand::Submit([location, value]() { glUniform3f(location, value.x, value.y, value.z); });
 	}
 
-	void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& value) const
+	void OpenGLShader::UploadUniformFloat4(UniformId id, const glm::vec4& value) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniform3f(location, value.x, value.y, value.z);
+		GLint location = GetUniformLocation(id);
+		if (location >= 0)
+			RenderCommand::Submit([location, value]() { glUniform4f(location, value.x, value.y, value.z, value.w); });
 	}
 
-	void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& value) const
+	void OpenGLShader::UploadUniformMat3(UniformId id, const glm::mat3& matrix) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniform4f(location, value.x, value.y, value.z, value.w);
+		GLint location = GetUniformLocation(id);
+		if (location >= 0)
+			RenderCommand::Submit([location, matrix]() { glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix)); });
 	}
 
-	void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix) const
+	void OpenGLShader::UploadUniformMat4(UniformId id, const glm::mat4& matrix) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+		GLint location = GetUniformLocation(id);
+		if (location >= 0)
+			RenderCommand::Submit([location, matrix]() { glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix)); });
 	}
 
-	void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix) const
+	int32_t OpenGLShader::GetUniformLocation(UniformId id) const
 	{
-		GLint location = glGetUniformLocation(m_RendererId, name.c_str());
-		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
+		WaitUntilLinked();
+		if (m_UniformSlots.empty())
+			return -1;
+
+		uint32_t mask = (uint32_t)m_UniformSlots.size() - 1;
+		for (uint32_t i = id.Hash & mask; m_UniformSlots[i].Location >= 0; i = (i + 1) & mask)
+		{
+			if (m_UniformSlots[i].Hash == id.Hash)
+				return m_UniformSlots[i].Location;
+		}
+
+		return -1;
 	}
 
 	std::string OpenGLShader::ReadFile(const std::string& filepath)
@@ -212,20 +291,52 @@ namespace Hazel {
 			);
 		}
 
+		// Sampler arrays are sized with HZ_MAX_TEXTURE_SLOTS, GL only guarantees 16 units
+		std::string defines = "#define HZ_MAX_TEXTURE_SLOTS " + std::to_string(RenderCommand::GetMaxTextureSlots()) + "\n";
+		for (auto& [type, shaderSrc] : shaderSrcs)
+		{
+			size_t version = shaderSrc.find("#version");
+			size_t eol = version == std::string::npos ? std::string::npos : shaderSrc.find('\n', version);
+			HZ_CORE_ASSERT(eol != std::string::npos, "Shader stage without a #version line")
+			shaderSrc.insert(eol + 1, defines);
+		}
+
 		return shaderSrcs;
 	}
 
 	void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSrcs)
 	{
 		HZ_PROFILE_FUNCTION()
-		
-		// Store shader ids
-		std::vector<GLuint> shaderIds;
+
+		// Hash the stages in a fixed order, the map's order is unspecified
+		std::vector<GLenum> types;
+		for (auto& kv : shaderSrcs)
+			types.push_back(kv.first);
+		std::sort(types.begin(), types.end());
+
+		uint64_t hash = ShaderCache::HashSeed;
+		for (GLenum type : types)
+		{
+			hash = ShaderCache::Hash(&type, sizeof(type), hash);
+			hash = ShaderCache::Hash(shaderSrcs.at(type), hash);
+		}
+		m_SourceHash = hash;
+
+		if (LoadProgramBinary(hash))
+		{
+			CacheUniformLocations();
+			ReflectInputs();
+			m_Linked = true;
+			return;
+		}
 
 		// Get a program object.
 		GLuint program = glCreateProgram();
+		if (!GetDriverString().empty())
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 
-		// Process each shader
+		// Process each shader. Nothing here waits on the compiler, the statuses are only queried
+		// in FinishCompile, so drivers with parallel shader compile work on several programs at once.
 		for (auto& kv : shaderSrcs)
 		{
 			GLenum type = kv.first;
@@ -241,60 +352,61 @@ namespace Hazel {
 			// Compile the shader
 			glCompileShader(shader);
 
-			GLint isCompiled = 0;
-			glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
-			if (isCompiled == GL_FALSE)
-			{
-				GLint maxLength = 0;
-				glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
-
-				// The maxLength includes the NULL character
-				std::vector<GLchar> infoLog(maxLength);
-				glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
-
-				// We don't need the shader anymore
-				glDeleteShader(shader);
-
-				HZ_CORE_ERROR("{0}", infoLog.data())
-				HZ_CORE_ASSERT(false, "Shader compilation failure!")
-				return;
-			}
-
 			// Attach our shader to program
 			glAttachShader(program, shader);
 
 			// Store the shader id
-			shaderIds.push_back(shader);
+			m_ShaderIds.push_back(shader);
 		}
 
-		// Vertex and fragment shaders are successfully compiled.
-		// Now time to link them together into a program.
-		m_RendererId = program;
-
 		// Link our program
+		m_RendererId = program;
 		glLinkProgram(m_RendererId);
+	}
+
+	void OpenGLShader::FinishCompile()
+	{
+		HZ_PROFILE_FUNCTION()
 
 		// Note the different functions here: glGetProgram* instead of glGetShader*.
+		// Blocks until the driver is done with the program.
 		GLint isLinked = 0;
 		glGetProgramiv(m_RendererId, GL_LINK_STATUS, (int*)&isLinked);
 		if (isLinked == GL_FALSE)
 		{
+			// A stage that failed to compile fails the link as well, its log is the useful one
+			for (auto shaderId : m_ShaderIds)
+			{
+				GLint isCompiled = 0;
+				glGetShaderiv(shaderId, GL_COMPILE_STATUS, &isCompiled);
+				if (isCompiled == GL_FALSE)
+				{
+					GLint maxLength = 0;
+					glGetShaderiv(shaderId, GL_INFO_LOG_LENGTH, &maxLength);
+
+					// The maxLength includes the NULL character
+					std::vector<GLchar> infoLog(maxLength + 1);
+					glGetShaderInfoLog(shaderId, maxLength, &maxLength, &infoLog[0]);
+					HZ_CORE_ERROR("{0}", infoLog.data())
+				}
+			}
+
 			GLint maxLength = 0;
 			glGetProgramiv(m_RendererId, GL_INFO_LOG_LENGTH, &maxLength);
 
 			// The maxLength includes the NULL character
-			std::vector<GLchar> infoLog(maxLength);
+			std::vector<GLchar> infoLog(maxLength + 1);
 			glGetProgramInfoLog(m_RendererId, maxLength, &maxLength, &infoLog[0]);
 
 			// We don't need the program anymore
 			glDeleteProgram(m_RendererId);
 
 			// Don't leak shaders either
-			for (auto shaderId : shaderIds)
+			for (auto shaderId : m_ShaderIds)
 			{
 				glDeleteShader(shaderId);
 			}
-
+			m_ShaderIds.clear();
 
 			HZ_CORE_ERROR("{0}", infoLog.data())
 			HZ_CORE_ASSERT(false, "Shader link failure!")
@@ -302,10 +414,156 @@ namespace Hazel {
 		}
 
 		// Always detach shaders after a successful link
-		for (auto shaderId : shaderIds)
+		for (auto shaderId : m_ShaderIds)
 		{
 			glDetachShader(m_RendererId, shaderId);
+			glDeleteShader(shaderId);
 		}
+		m_ShaderIds.clear();
+
+		StoreProgramBinary(m_SourceHash);
+		CacheUniformLocations();
+		ReflectInputs();
+	}
+
+	const ShaderReflection& OpenGLShader::GetReflection() const
+	{
+		WaitUntilLinked();
+		return m_Reflection;
+	}
+
+	void OpenGLShader::WaitUntilLinked() const
+	{
+		if (m_Linked)
+			return;
+
+		OpenGLShader* shader = const_cast<OpenGLShader*>(this);
+		RenderCommand::SubmitAndWait([shader]() { shader->FinishCompile(); });
+		m_Linked = true;
+	}
+
+	bool OpenGLShader::LoadProgramBinary(uint64_t hash)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		// The binary is prefixed with its format
+		std::vector<uint8_t> data;
+		if (GetDriverString().empty() || !ShaderCache::Load("glbin", hash, GetDriverString(), data) || data.size() <= sizeof(GLenum))
+			return false;
+
+		GLenum format;
+		memcpy(&format, data.data(), sizeof(GLenum));
+
+		GLuint program = glCreateProgram();
+		glProgramBinary(program, format, data.data() + sizeof(GLenum), (GLsizei)(data.size() - sizeof(GLenum)));
+
+		// Drivers may still reject a binary, then the sources are compiled as usual
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
+		{
+			glDeleteProgram(program);
+			return false;
+		}
+
+		m_RendererId = program;
+		return true;
+	}
+
+	void OpenGLShader::StoreProgramBinary(uint64_t hash)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		if (GetDriverString().empty())
+			return;
+
+		GLint length = 0;
+		glGetProgramiv(m_RendererId, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+
+		std::vector<uint8_t> data(sizeof(GLenum) + length);
+		GLenum format = 0;
+		glGetProgramBinary(m_RendererId, length, &length, &format, data.data() + sizeof(GLenum));
+		memcpy(data.data(), &format, sizeof(GLenum));
+
+		ShaderCache::Store("glbin", hash, GetDriverString(), data.data(), sizeof(GLenum) + length);
+	}
+
+	void OpenGLShader::CacheUniformLocations()
+	{
+		HZ_PROFILE_FUNCTION()
+
+		GLint count = 0, maxLength = 0;
+		glGetProgramiv(m_RendererId, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(m_RendererId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		// Arrays take two slots, keeps the table at most half full
+		uint32_t capacity = 16;
+		while (capacity < (uint32_t)count * 4)
+			capacity *= 2;
+		m_UniformSlots.assign(capacity, { 0, -1 });
+
+		std::vector<GLchar> name(maxLength + 1);
+		for (GLint i = 0; i < count; i++)
+		{
+			GLsizei length = 0;
+			glGetActiveUniformName(m_RendererId, i, maxLength + 1, &length, name.data());
+
+			// Members of uniform blocks have no location
+			GLint location = glGetUniformLocation(m_RendererId, name.data());
+			if (location < 0)
+				continue;
+
+			AddUniformLocation(name.data(), location);
+
+			// Arrays are reported as "name[0]", make them reachable by their plain name as well
+			if (length > 3 && strcmp(name.data() + length - 3, "[0]") == 0)
+			{
+				name[length - 3] = '\0';
+				AddUniformLocation(name.data(), location);
+			}
+		}
+	}
+
+	void OpenGLShader::ReflectInputs()
+	{
+		// Shaders cross-compiled from SPIR-V get the full reflection from ShaderLibrary
+		if (!m_Reflection.Inputs.empty())
+			return;
+
+		GLint count = 0;
+		glGetProgramInterfaceiv(m_RendererId, GL_PROGRAM_INPUT, GL_ACTIVE_RESOURCES, &count);
+
+		const GLenum properties[] = { GL_NAME_LENGTH, GL_LOCATION, GL_TYPE };
+		for (GLint i = 0; i < count; i++)
+		{
+			GLint values[3];
+			glGetProgramResourceiv(m_RendererId, GL_PROGRAM_INPUT, i, 3, properties, 3, nullptr, values);
+
+			// Built-ins like gl_VertexID have no location
+			if (values[1] < 0)
+				continue;
+
+			std::vector<GLchar> name(values[0]);
+			glGetProgramResourceName(m_RendererId, GL_PROGRAM_INPUT, i, values[0], nullptr, name.data());
+			m_Reflection.Inputs.push_back({ name.data(), (uint32_t)values[1], GLTypeToShaderDataType(values[2]) });
+		}
+	}
+
+	void OpenGLShader::AddUniformLocation(const char* name, int32_t location)
+	{
+		uint32_t hash = UniformId::HashName(name);
+		uint32_t mask = (uint32_t)m_UniformSlots.size() - 1;
+
+		uint32_t i = hash & mask;
+		while (m_UniformSlots[i].Location >= 0)
+		{
+			HZ_CORE_ASSERT(m_UniformSlots[i].Hash != hash, "Uniform name hash collision!")
+			i = (i + 1) & mask;
+		}
+
+		m_UniformSlots[i] = { hash, location };
 	}
 
 }
\ No newline at end of file
@@ -17,38 +17,68 @@ namespace Hazel {
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 
-		virtual void SetInt(const std::string& name, int value) override;
-		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override;
+		virtual void SetInt(UniformId id, int value) override;
+		virtual void SetIntArray(UniformId id, int* values, uint32_t count) override;
 		
-		virtual void SetFloat(const std::string& name, float value) override;
-		virtual void SetFloat2(const std::string& name, const glm::vec2& value) override;
-		virtual void SetFloat3(const std::string& name, const glm::vec3& value) override;
-		virtual void SetFloat4(const std::string& name, const glm::vec4& value) override;
+		virtual void SetFloat(UniformId id, float value) override;
+		virtual void SetFloat2(UniformId id, const glm::vec2& value) override;
+		virtual void SetFloat3(UniformId id, const glm::vec3& value) override;
+		virtual void SetFloat4(UniformId id, const glm::vec4& value) override;
 
-		virtual void SetMat3(const std::string& name, const glm::mat3& value) override;
-		virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
+		virtual void SetMat3(UniformId id, const glm::mat3& value) override;
+		virtual void SetMat4(UniformId id, const glm::mat4& value) override;
 
 		virtual const std::string& GetName() const override { return m_Name; };
 
-		void UploadUniformInt(const std::string& name, int value) const;
-		void UploadUniformIntArray(const std::string& name, int* values, uint32_t count) const;
+		// GLSL programs only know their inputs once they are linked
+		virtual const ShaderReflection& GetReflection() const override;
 
-		void UploadUniformFloat(const std::string& name, float value) const;
-		void UploadUniformFloat2(const std::string& name, const glm::vec2& value) const;
-		void UploadUniformFloat3(const std::string& name, const glm::vec3& value) const;
-		void UploadUniformFloat4(const std::string& name, const glm::vec4& value) const;
+		void UploadUniformInt(UniformId id, int value) const;
+		void UploadUniformIntArray(UniformId id, int* values, uint32_t count) const;
 
-		void UploadUniformMat3(const std::string& name, const glm::mat3& matrix) const;
-		void UploadUniformMat4(const std::string& name, const glm::mat4& matrix) const;
+		void UploadUniformFloat(UniformId id, float value) const;
+		void UploadUniformFloat2(UniformId id, const glm::vec2& value) const;
+		void UploadUniformFloat3(UniformId id, const glm::vec3& value) const;
+		void UploadUniformFloat4(UniformId id, const glm::vec4& value) const;
+
+		void UploadUniformMat3(UniformId id, const glm::mat3& matrix) const;
+		void UploadUniformMat4(UniformId id, const glm::mat4& matrix) const;
+
+		// -1 if the program has no active uniform with that name
+		int32_t GetUniformLocation(UniformId id) const;
+
+		// Programs are linked in the background, this waits for the result. Called by the first
+		// Bind or uniform upload.
+		void WaitUntilLinked() const;
 
 	private:
 		std::string ReadFile(const std::string& filepath);
 		std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
 		void Compile(const std::unordered_map<GLenum, std::string>& shaderSrcs);
+		void FinishCompile();
+		bool LoadProgramBinary(uint64_t hash);
+		void StoreProgramBinary(uint64_t hash);
+		void CacheUniformLocations();
+		// Vertex inputs of shaders created from GLSL, known once the program is linked
+		void ReflectInputs();
+		void AddUniformLocation(const char* name, int32_t location);
 
 	private:
 		uint32_t m_RendererId;
 		std::string m_Name;
+
+		// Until the program is linked
+		std::vector<uint32_t> m_ShaderIds;
+		uint64_t m_SourceHash = 0;
+		mutable bool m_Linked = false;
+
+		// Open addressing table of the active uniforms, indexed by UniformId hash
+		struct UniformSlot
+		{
+			uint32_t Hash;
+			int32_t Location; // -1 for empty slots
+		};
+		std::vector<UniformSlot> m_UniformSlots;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include "hzpch.h"
+#include "OpenGLState.h"
+
+#include <glad/glad.h>
+#include <atomic>
+
+namespace Hazel {
+
+	static thread_local OpenGLState* s_CurrentState = nullptr;
+
+	static std::atomic<uint32_t> s_Binds = 0;
+	static std::atomic<uint32_t> s_SkippedBinds = 0;
+
+	// Slot in OpenGLState::m_Buffers, -1 for targets that are not tracked
+	static int32_t BufferTargetIndex(GLenum target)
+	{
+		switch (target)
+		{
+			case GL_ARRAY_BUFFER:          return 0;
+			case GL_ELEMENT_ARRAY_BUFFER:  return 1;
+			case GL_UNIFORM_BUFFER:        return 2;
+			case GL_SHADER_STORAGE_BUFFER: return 3;
+			case GL_DRAW_INDIRECT_BUFFER:  return 4;
+		}
+
+		return -1;
+	}
+
+	OpenGLState::OpenGLState()
+	{
+		// The defaults of a new context
+		m_Program = 0;
+		m_VertexArray = 0;
+		std::fill_n(m_Buffers, s_BufferTargetCount, 0);
+		std::fill_n(m_TextureUnits, s_TextureUnitCount, 0);
+
+		m_Blend = GL_FALSE;
+		m_BlendSrcFactor = GL_ONE;
+		m_BlendDstFactor = GL_ZERO;
+		m_DepthTest = GL_FALSE;
+	}
+
+	OpenGLState& OpenGLState::Get()
+	{
+		HZ_CORE_ASSERT(s_CurrentState, "No OpenGL context is current on this thread!")
+		return *s_CurrentState;
+	}
+
+	void OpenGLState::SetCurrent(OpenGLState* state)
+	{
+		s_CurrentState = state;
+	}
+
+	void OpenGLState::UseProgram(uint32_t program)
+	{
+		if (Update(m_Program, program))
+			glUseProgram(program);
+	}
+
+	void OpenGLState::BindVertexArray(uint32_t vertexArray)
+	{
+		if (Update(m_VertexArray, vertexArray))
+		{
+			glBindVertexArray(vertexArray);
+
+			// The element buffer binding is part of the vertex array
+			m_Buffers[BufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = s_Unknown;
+		}
+	}
+
+	void OpenGLState::BindBuffer(uint32_t target, uint32_t buffer)
+	{
+		int32_t index = BufferTargetIndex(target);
+		if (index < 0)
+		{
+			s_Binds++;
+			glBindBuffer(target, buffer);
+		}
+		else if (Update(m_Buffers[index], buffer))
+		{
+			glBindBuffer(target, buffer);
+		}
+	}
+
+	void OpenGLState::BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer)
+	{
+		BindBufferRange(target, index, buffer, 0, 0);
+	}
+
+	void OpenGLState::BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, uint32_t offset, uint32_t size)
+	{
+		int32_t targetIndex = BufferTargetIndex(target);
+		if (targetIndex >= 0 && index < s_IndexedBindingCount)
+		{
+			IndexedBinding& binding = m_IndexedBuffers[targetIndex][index];
+			if (binding.Buffer == buffer && binding.Offset == offset && binding.Size == size)
+			{
+				s_SkippedBinds++;
+				return;
+			}
+
+			binding = { buffer, offset, size };
+		}
+
+		s_Binds++;
+		if (size)
+			glBindBufferRange(target, index, buffer, offset, size);
+		else
+			glBindBufferBase(target, index, buffer);
+
+		if (targetIndex >= 0)
+			m_Buffers[targetIndex] = buffer;
+	}
+
+	void OpenGLState::BindTextureUnit(uint32_t unit, uint32_t texture)
+	{
+		if (unit >= s_TextureUnitCount)
+		{
+			s_Binds++;
+			glBindTextureUnit(unit, texture);
+		}
+		else if (Update(m_TextureUnits[unit], texture))
+		{
+			glBindTextureUnit(unit, texture);
+		}
+	}
+
+	void OpenGLState::SetBlend(bool enabled)
+	{
+		if (Update(m_Blend, enabled ? GL_TRUE : GL_FALSE))
+		{
+			if (enabled)
+				glEnable(GL_BLEND);
+			else
+				glDisable(GL_BLEND);
+		}
+	}
+
+	void OpenGLState::SetBlendFunc(uint32_t srcFactor, uint32_t dstFactor)
+	{
+		if (srcFactor == m_BlendSrcFactor && dstFactor == m_BlendDstFactor)
+		{
+			s_SkippedBinds++;
+			return;
+		}
+
+		s_Binds++;
+		m_BlendSrcFactor = srcFactor;
+		m_BlendDstFactor = dstFactor;
+		glBlendFunc(srcFactor, dstFactor);
+	}
+
+	void OpenGLState::SetDepthTest(bool enabled)
+	{
+		if (Update(m_DepthTest, enabled ? GL_TRUE : GL_FALSE))
+		{
+			if (enabled)
+				glEnable(GL_DEPTH_TEST);
+			else
+				glDisable(GL_DEPTH_TEST);
+		}
+	}
+
+	void OpenGLState::OnDeleteProgram(uint32_t program)
+	{
+		// A program in use is only deleted once it is replaced, force the next UseProgram through
+		if (m_Program == program)
+			m_Program = s_Unknown;
+	}
+
+	void OpenGLState::OnDeleteVertexArray(uint32_t vertexArray)
+	{
+		if (m_VertexArray == vertexArray)
+		{
+			m_VertexArray = 0;
+			m_Buffers[BufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = s_Unknown;
+		}
+	}
+
+	void OpenGLState::OnDeleteBuffer(uint32_t buffer)
+	{
+		for (uint32_t& binding : m_Buffers)
+		{
+			if (binding == buffer)
+				binding = 0;
+		}
+
+		for (auto& bindings : m_IndexedBuffers)
+		{
+			for (IndexedBinding& binding : bindings)
+			{
+				if (binding.Buffer == buffer)
+					binding = {};
+			}
+		}
+	}
+
+	void OpenGLState::OnDeleteTexture(uint32_t texture)
+	{
+		for (uint32_t& binding : m_TextureUnits)
+		{
+			if (binding == texture)
+				binding = 0;
+		}
+	}
+
+	OpenGLState::Statistics OpenGLState::GetStats()
+	{
+		Statistics stats;
+		stats.Binds = s_Binds;
+		stats.SkippedBinds = s_SkippedBinds;
+		return stats;
+	}
+
+	void OpenGLState::ResetStats()
+	{
+		s_Binds = 0;
+		s_SkippedBinds = 0;
+	}
+
+	bool OpenGLState::Update(uint32_t& current, uint32_t value)
+	{
+		if (current == value)
+		{
+			s_SkippedBinds++;
+			return false;
+		}
+
+		s_Binds++;
+		current = value;
+		return true;
+	}
+
+}
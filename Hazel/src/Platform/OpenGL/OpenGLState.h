@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+namespace Hazel {
+
+	// Shadow copy of the binding and fixed function state of a context, so redundant binds never
+	// reach the driver. Every change to tracked state has to go through it, except for code that
+	// restores what it changed (like the ImGui backend).
+	class HAZEL_API OpenGLState
+	{
+	public:
+		OpenGLState();
+
+		// State of the context current on the calling thread
+		static OpenGLState& Get();
+		static void SetCurrent(OpenGLState* state);
+
+		void UseProgram(uint32_t program);
+		void BindVertexArray(uint32_t vertexArray);
+		void BindBuffer(uint32_t target, uint32_t buffer);
+		// Indexed binding points, size 0 binds the whole buffer. Also sets the generic binding.
+		void BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer);
+		void BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, uint32_t offset, uint32_t size);
+		void BindTextureUnit(uint32_t unit, uint32_t texture);
+
+		void SetBlend(bool enabled);
+		void SetBlendFunc(uint32_t srcFactor, uint32_t dstFactor);
+		void SetDepthTest(bool enabled);
+
+		// Deleting an object resets the bindings that refer to it
+		void OnDeleteProgram(uint32_t program);
+		void OnDeleteVertexArray(uint32_t vertexArray);
+		void OnDeleteBuffer(uint32_t buffer);
+		void OnDeleteTexture(uint32_t texture);
+
+		// Stats, summed over all contexts
+		struct Statistics
+		{
+			uint32_t Binds = 0;
+			uint32_t SkippedBinds = 0;
+		};
+
+		static Statistics GetStats();
+		static void ResetStats();
+
+	private:
+		// Returns true when value changed, counts the call either way
+		static bool Update(uint32_t& current, uint32_t value);
+
+	private:
+		static const uint32_t s_Unknown = 0xFFFFFFFF;
+		static const uint32_t s_BufferTargetCount = 5;
+		static const uint32_t s_TextureUnitCount = 32;
+		static const uint32_t s_IndexedBindingCount = 16;
+
+		struct IndexedBinding
+		{
+			uint32_t Buffer = 0;
+			uint32_t Offset = 0;
+			uint32_t Size = 0;
+		};
+
+		uint32_t m_Program;
+		uint32_t m_VertexArray;
+		uint32_t m_Buffers[s_BufferTargetCount];
+		IndexedBinding m_IndexedBuffers[s_BufferTargetCount][s_IndexedBindingCount];
+		uint32_t m_TextureUnits[s_TextureUnitCount];
+
+		uint32_t m_Blend;
+		uint32_t m_BlendSrcFactor, m_BlendDstFactor;
+		uint32_t m_DepthTest;
+	};
+
+}
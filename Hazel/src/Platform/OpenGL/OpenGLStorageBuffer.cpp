@@ -0,0 +1,54 @@
+#include "hzpch.h"
+#include "OpenGLStorageBuffer.h"
+#include "OpenGLState.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
+
+#include <glad/glad.h>
+
+namespace Hazel {
+
+	OpenGLStorageBuffer::OpenGLStorageBuffer(uint32_t size)
+		: m_Size(size)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		RenderCommand::SubmitAndWait([this, size]()
+		{
+			glCreateBuffers(1, &m_RendererId);
+			glNamedBufferData(m_RendererId, size, nullptr, GL_DYNAMIC_DRAW);
+		});
+	}
+
+	OpenGLStorageBuffer::~OpenGLStorageBuffer()
+	{
+		HZ_PROFILE_FUNCTION()
+		RenderCommand::Submit([rendererId = m_RendererId]()
+		{
+			OpenGLState::Get().OnDeleteBuffer(rendererId);
+			glDeleteBuffers(1, &rendererId);
+		});
+	}
+
+	void OpenGLStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(offset + size <= m_Size, "Data does not fit into the buffer!")
+
+		data = RenderCommand::CopyData(data, size);
+		RenderCommand::Submit([rendererId = m_RendererId, data, size, offset]()
+		{
+			glNamedBufferSubData(rendererId, offset, size, data);
+		});
+	}
+
+	void OpenGLStorageBuffer::Bind(uint32_t binding) const
+	{
+		HZ_PROFILE_FUNCTION()
+		RenderCommand::Submit([rendererId = m_RendererId, binding]()
+		{
+			OpenGLState::Get().BindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, rendererId);
+		});
+	}
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Hazel/Renderer/StorageBuffer.h"
+
+namespace Hazel {
+
+	class HAZEL_API OpenGLStorageBuffer : public StorageBuffer
+	{
+	public:
+		OpenGLStorageBuffer(uint32_t size);
+		virtual ~OpenGLStorageBuffer();
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void Bind(uint32_t binding) const override;
+
+		virtual uint32_t GetSize() const override { return m_Size; }
+
+	private:
+		uint32_t m_RendererId;
+		uint32_t m_Size;
+	};
+
+}
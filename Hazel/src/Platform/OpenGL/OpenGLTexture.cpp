@@ -1,5 +1,8 @@
 #include "hzpch.h"
 #include "OpenGLTexture.h"
+#include "OpenGLState.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
 
 #include <glad/glad.h>
 #include "stb_image.h"
@@ -16,7 +19,7 @@ namespace Hazel {
 		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
 		HZ_CORE_ASSERT(data, "Failed to load image!")
 
-		Create(data, width, height, channels);
+		RenderCommand::SubmitAndWait([&]() { Create(data, width, height, channels); });
 
 		stbi_image_free(data);
 	}
@@ -29,19 +32,23 @@ namespace Hazel {
 	) : m_Path(""), m_Width(width), m_Height(height)
 	{
 		HZ_PROFILE_FUNCTION()
-		Create(data, width, height, channels);
+		RenderCommand::SubmitAndWait([&]() { Create(data, width, height, channels); });
 	}
 
 	OpenGLTexture2D::~OpenGLTexture2D()
 	{
 		HZ_PROFILE_FUNCTION()
-		glDeleteTextures(1, &m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]()
+		{
+			OpenGLState::Get().OnDeleteTexture(rendererId);
+			glDeleteTextures(1, &rendererId);
+		});
 	}
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
 	{
 		HZ_PROFILE_FUNCTION()
-		glBindTextureUnit(slot, m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId, slot]() { OpenGLState::Get().BindTextureUnit(slot, rendererId); });
 	}
 
 	void OpenGLTexture2D::SetData(void* data, uint32_t size)
@@ -49,7 +56,25 @@ namespace Hazel {
 		HZ_PROFILE_FUNCTION()
 		uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
 		HZ_CORE_ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!")
-		glTextureSubImage2D(m_RendererId, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+
+		const void* copy = RenderCommand::CopyData(data, size);
+		RenderCommand::Submit([rendererId = m_RendererId, width = m_Width, height = m_Height, format = m_DataFormat, copy]()
+		{
+			glTextureSubImage2D(rendererId, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, copy);
+		});
+	}
+
+	void OpenGLTexture2D::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(x + width <= m_Width && y + height <= m_Height, "Region must be inside the texture!")
+
+		uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
+		data = RenderCommand::CopyData(data, width * height * bpp);
+		RenderCommand::Submit([rendererId = m_RendererId, format = m_DataFormat, data, x, y, width, height]()
+		{
+			glTextureSubImage2D(rendererId, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, data);
+		});
 	}
 
 	void OpenGLTexture2D::Create(const void* data, uint32_t width, uint32_t height, uint32_t channels)
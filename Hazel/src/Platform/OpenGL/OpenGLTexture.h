@@ -16,9 +16,12 @@ namespace Hazel {
 		virtual void Bind(uint32_t slot = 0) const override;
 
 		virtual void SetData(void* data, uint32_t size) override;
+		virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
 		virtual uint32_t GetWidth() const override { return m_Width; }
 		virtual uint32_t GetHeight() const override { return m_Height; }
+
+		virtual bool HasAlpha() const override { return m_DataFormat == GL_RGBA; }
 		
 		uint32_t GetId() const { return m_RendererId; }
 
@@ -0,0 +1,69 @@
+#include "hzpch.h"
+#include "OpenGLUniformBuffer.h"
+#include "OpenGLState.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
+
+#include <glad/glad.h>
+
+namespace Hazel {
+
+	OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size)
+		: m_Size(size)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		RenderCommand::SubmitAndWait([this, size]()
+		{
+			glCreateBuffers(1, &m_RendererId);
+			glNamedBufferData(m_RendererId, size, nullptr, GL_DYNAMIC_DRAW);
+
+			GLint alignment = 0;
+			glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+			m_OffsetAlignment = (uint32_t)alignment;
+		});
+	}
+
+	OpenGLUniformBuffer::~OpenGLUniformBuffer()
+	{
+		HZ_PROFILE_FUNCTION()
+		RenderCommand::Submit([rendererId = m_RendererId]()
+		{
+			OpenGLState::Get().OnDeleteBuffer(rendererId);
+			glDeleteBuffers(1, &rendererId);
+		});
+	}
+
+	void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(offset + size <= m_Size, "Data does not fit into the buffer!")
+
+		data = RenderCommand::CopyData(data, size);
+		RenderCommand::Submit([rendererId = m_RendererId, data, size, offset]()
+		{
+			glNamedBufferSubData(rendererId, offset, size, data);
+		});
+	}
+
+	void OpenGLUniformBuffer::Bind(uint32_t binding) const
+	{
+		HZ_PROFILE_FUNCTION()
+		RenderCommand::Submit([rendererId = m_RendererId, binding]()
+		{
+			OpenGLState::Get().BindBufferBase(GL_UNIFORM_BUFFER, binding, rendererId);
+		});
+	}
+
+	void OpenGLUniformBuffer::BindRange(uint32_t binding, uint32_t offset, uint32_t size) const
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(offset % m_OffsetAlignment == 0, "Offset is not aligned!")
+
+		RenderCommand::Submit([rendererId = m_RendererId, binding, offset, size]()
+		{
+			OpenGLState::Get().BindBufferRange(GL_UNIFORM_BUFFER, binding, rendererId, offset, size);
+		});
+	}
+
+}
@@ -1,5 +1,8 @@
 #include "hzpch.h"
 #include "OpenGLVertexArray.h"
+#include "OpenGLState.h"
+
+#include "Hazel/Renderer/RenderCommand.h"
 
 #include <glad/glad.h>
 
@@ -18,6 +21,9 @@ namespace Hazel {
 			case Hazel::ShaderDataType::Int2:      return GL_INT;
 			case Hazel::ShaderDataType::Int3:      return GL_INT;
 			case Hazel::ShaderDataType::Int4:      return GL_INT;
+			case Hazel::ShaderDataType::UInt:      return GL_UNSIGNED_INT;
+			case Hazel::ShaderDataType::UByte4:    return GL_UNSIGNED_BYTE;
+			case Hazel::ShaderDataType::UShort2:   return GL_UNSIGNED_SHORT;
 			case Hazel::ShaderDataType::Mat3:      return GL_FLOAT;
 			case Hazel::ShaderDataType::Mat4:      return GL_FLOAT;
 		}
@@ -28,59 +34,109 @@ namespace Hazel {
 
 	OpenGLVertexArray::OpenGLVertexArray()
 	{
-		glCreateVertexArrays(1, &m_RendererId);
+		RenderCommand::SubmitAndWait([this]() { glCreateVertexArrays(1, &m_RendererId); });
 	}
 
 	OpenGLVertexArray::~OpenGLVertexArray()
 	{
-		glDeleteVertexArrays(1, &m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]()
+		{
+			OpenGLState::Get().OnDeleteVertexArray(rendererId);
+			glDeleteVertexArrays(1, &rendererId);
+		});
 	}
 
 	void OpenGLVertexArray::Bind() const
 	{
-		glBindVertexArray(m_RendererId);
+		RenderCommand::Submit([rendererId = m_RendererId]() { OpenGLState::Get().BindVertexArray(rendererId); });
 	}
 
 	void OpenGLVertexArray::Unbind() const
 	{
-		glBindVertexArray(0);
+		RenderCommand::Submit([]() { OpenGLState::Get().BindVertexArray(0); });
 	}
 
 	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
 	{
-		glBindVertexArray(m_RendererId);
-		vertexBuffer->Bind();
-
 		HZ_CORE_ASSERT(
 			vertexBuffer->GetLayout().GetElements().size(),
 			"Vertex buffer has no layout!"
 		)
 
-		uint32_t index = 0;
-		const auto& layout = vertexBuffer->GetLayout();
+		const BufferLayout& layout = vertexBuffer->GetLayout();
+		std::vector<uint32_t> locations;
+		locations.reserve(layout.GetElements().size());
 		for (const auto& element : layout)
 		{
-			glEnableVertexAttribArray(index);
-			glVertexAttribPointer(
-				index,
-				element.GetComponentCount(),
-				ShaderDataTypeToOpenGLBaseType(element.Type),
-				element.Normalized ? GL_TRUE : GL_FALSE,
-				layout.GetStride(),
-				(GLvoid*)element.Offset
-			);
-			index++;
+			uint32_t location = element.Location >= 0 ? (uint32_t)element.Location : m_NextLocation;
+			locations.push_back(location);
+			m_NextLocation = location + element.GetLocationCount();
 		}
 
+		// The layout is copied, the buffer may change it before the command executes
+		RenderCommand::Submit([rendererId = m_RendererId, vertexBuffer, layout, locations = std::move(locations)]()
+		{
+			OpenGLState::Get().BindVertexArray(rendererId);
+			vertexBuffer->Bind();
+			SetupAttributes(layout, locations);
+		});
+
 		m_VertexBuffers.push_back(vertexBuffer);
 	}
 
 	void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
 	{
-		glBindVertexArray(m_RendererId);
-		indexBuffer->Bind();
+		RenderCommand::Submit([rendererId = m_RendererId, indexBuffer]()
+		{
+			OpenGLState::Get().BindVertexArray(rendererId);
+			indexBuffer->Bind();
+		});
 
 		m_IndexBuffer = indexBuffer;
 	}
 
+	void OpenGLVertexArray::SetupAttributes(const BufferLayout& layout, const std::vector<uint32_t>& locations)
+	{
+		for (size_t i = 0; i < locations.size(); i++)
+		{
+			const BufferElement& element = layout.GetElements()[i];
+
+			// Matrices are set up column by column
+			uint32_t columns = element.GetLocationCount();
+			uint32_t componentCount = element.GetComponentCount() / columns;
+			uint32_t columnSize = element.Size / columns;
+			for (uint32_t column = 0; column < columns; column++)
+			{
+				uint32_t index = locations[i] + column;
+				size_t offset = element.Offset + column * columnSize;
+
+				glEnableVertexAttribArray(index);
+				if (element.IsInteger())
+				{
+					glVertexAttribIPointer(
+						index,
+						componentCount,
+						ShaderDataTypeToOpenGLBaseType(element.Type),
+						layout.GetStride(),
+						(GLvoid*)offset
+					);
+				}
+				else
+				{
+					glVertexAttribPointer(
+						index,
+						componentCount,
+						ShaderDataTypeToOpenGLBaseType(element.Type),
+						element.Normalized ? GL_TRUE : GL_FALSE,
+						layout.GetStride(),
+						(GLvoid*)offset
+					);
+				}
+
+				if (layout.IsInstanced())
+					glVertexAttribDivisor(index, 1);
+			}
+		}
+	}
+
 }
\ No newline at end of file
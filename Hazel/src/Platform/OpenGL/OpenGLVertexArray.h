@@ -19,8 +19,13 @@ namespace Hazel {
 		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
 		virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
 
+	private:
+		// Points the attributes at the bound vertex buffer, expects the vertex array to be bound
+		static void SetupAttributes(const BufferLayout& layout, const std::vector<uint32_t>& locations);
+
 	private:
 		uint32_t m_RendererId;
+		uint32_t m_NextLocation = 0; // Attributes without a location continue across vertex buffers
 		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
 		Ref<IndexBuffer> m_IndexBuffer;
 	};
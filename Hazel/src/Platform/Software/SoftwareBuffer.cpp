@@ -0,0 +1,60 @@
+#include "hzpch.h"
+#include "SoftwareBuffer.h"
+
+namespace Hazel {
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// VertexBuffer ///////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	SoftwareVertexBuffer::SoftwareVertexBuffer(uint32_t size)
+	{
+		m_Data.resize(size);
+	}
+
+	SoftwareVertexBuffer::SoftwareVertexBuffer(float* vertices, uint32_t size)
+	{
+		m_Data.resize(size);
+		SetData(vertices, size);
+	}
+
+	void SoftwareVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(offset + size <= m_Data.size(), "Data does not fit into the buffer!")
+		memcpy(m_Data.data() + offset, data, size);
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// StreamingVertexBuffer //////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	SoftwareStreamingVertexBuffer::SoftwareStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount)
+		: m_RegionSize(regionSize), m_RegionCount(regionCount), m_RegionIndex(regionCount - 1)
+	{
+		m_Data.resize(regionSize * regionCount);
+	}
+
+	void SoftwareStreamingVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(offset + size <= m_RegionSize, "Data does not fit into a region!")
+		memcpy(m_Data.data() + GetRegionOffset() + offset, data, size);
+	}
+
+	void* SoftwareStreamingVertexBuffer::BeginRegion()
+	{
+		m_RegionIndex = (m_RegionIndex + 1) % m_RegionCount;
+		return m_Data.data() + GetRegionOffset();
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////
+	// IndexBuffer ////////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////
+
+	SoftwareIndexBuffer::SoftwareIndexBuffer(uint32_t* indices, uint32_t count)
+		: m_Indices(indices, indices + count)
+	{
+	}
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Hazel/Renderer/Buffer.h"
+
+namespace Hazel {
+
+	// CPU copy of a vertex buffer's contents, read by the rasterizer
+	class SoftwareBufferStorage
+	{
+	public:
+		virtual ~SoftwareBufferStorage() = default;
+
+		inline const uint8_t* GetData() const { return m_Data.data(); }
+
+	protected:
+		std::vector<uint8_t> m_Data;
+	};
+
+	class HAZEL_API SoftwareVertexBuffer : public VertexBuffer, public SoftwareBufferStorage
+	{
+	public:
+		SoftwareVertexBuffer(uint32_t size);
+		SoftwareVertexBuffer(float* vertices, uint32_t size);
+		virtual ~SoftwareVertexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+	private:
+		BufferLayout m_Layout;
+	};
+
+	// Draws complete before they return, so regions never have to be waited for
+	class HAZEL_API SoftwareStreamingVertexBuffer : public StreamingVertexBuffer, public SoftwareBufferStorage
+	{
+	public:
+		SoftwareStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+		virtual ~SoftwareStreamingVertexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void* BeginRegion() override;
+		virtual void EndRegion() override {}
+
+		virtual uint32_t GetRegionOffset() const override { return m_RegionIndex * m_RegionSize; }
+		virtual uint32_t GetRegionSize() const override { return m_RegionSize; }
+
+	private:
+		BufferLayout m_Layout;
+
+		uint32_t m_RegionSize;
+		uint32_t m_RegionCount;
+		uint32_t m_RegionIndex;
+	};
+
+	class HAZEL_API SoftwareIndexBuffer : public IndexBuffer
+	{
+	public:
+		SoftwareIndexBuffer(uint32_t* indices, uint32_t count);
+		virtual ~SoftwareIndexBuffer() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual uint32_t GetCount() const override { return (uint32_t)m_Indices.size(); }
+
+		inline const uint32_t* GetIndices() const { return m_Indices.data(); }
+
+	private:
+		std::vector<uint32_t> m_Indices;
+	};
+
+}
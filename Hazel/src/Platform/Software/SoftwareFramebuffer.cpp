@@ -0,0 +1,51 @@
+#include "hzpch.h"
+#include "SoftwareFramebuffer.h"
+
+#include "SoftwareRendererAPI.h"
+
+namespace Hazel {
+
+	SoftwareFramebuffer::SoftwareFramebuffer(FramebufferType type, uint32_t width, uint32_t height)
+		: m_Type(type), m_Width(width), m_Height(height)
+	{
+		m_Color = std::make_shared<SoftwareTexture2D>(nullptr, width, height, 4);
+		m_Depth.resize(width * height + 4, 1.0f);
+
+		// Like OpenGLFramebuffer, renderbuffers are not exposed as textures
+		if (type == FramebufferType::Texture2D)
+			m_Buffers.push_back(m_Color);
+	}
+
+	SoftwareFramebuffer::~SoftwareFramebuffer()
+	{
+		SoftwareRendererAPI::UnbindFramebuffer(this);
+	}
+
+	void SoftwareFramebuffer::Bind() const
+	{
+		SoftwareRendererAPI::BindFramebuffer(const_cast<SoftwareFramebuffer*>(this));
+	}
+
+	void SoftwareFramebuffer::Unbind() const
+	{
+		SoftwareRendererAPI::BindFramebuffer(nullptr);
+	}
+
+	void SoftwareFramebuffer::BlitTo(const Framebuffer* const framebuffer) const
+	{
+		HZ_PROFILE_FUNCTION()
+
+		// Same backend, so this is always a SoftwareFramebuffer (or the default one)
+		SoftwareFramebuffer* target = framebuffer
+			? const_cast<SoftwareFramebuffer*>(static_cast<const SoftwareFramebuffer*>(framebuffer))
+			: SoftwareRendererAPI::GetDefaultFramebuffer();
+		if (!target)
+			return;
+
+		uint32_t width = std::min(m_Width, target->m_Width);
+		uint32_t height = std::min(m_Height, target->m_Height);
+		for (uint32_t y = 0; y < height; y++)
+			memcpy(target->GetColorBuffer() + y * target->m_Width, GetColorBuffer() + y * m_Width, width * sizeof(uint32_t));
+	}
+
+}
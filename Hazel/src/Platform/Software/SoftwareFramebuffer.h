@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Hazel/Renderer/Framebuffer.h"
+
+#include "SoftwareTexture.h"
+
+namespace Hazel {
+
+	// Color and depth in CPU memory, the color buffer doubles as the Texture2D attachment
+	class HAZEL_API SoftwareFramebuffer : public Framebuffer
+	{
+	public:
+		SoftwareFramebuffer(FramebufferType type, uint32_t width, uint32_t height);
+		virtual ~SoftwareFramebuffer();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void BlitTo(const Framebuffer* const framebuffer) const override;
+
+		inline virtual const std::shared_ptr<Texture2D>& GetBuffer(int index) const override
+		{
+			return m_Buffers[index];
+		}
+
+		inline uint32_t GetWidth() const { return m_Width; }
+		inline uint32_t GetHeight() const { return m_Height; }
+
+		// RGBA8, rows bottom to top
+		inline uint32_t* GetColorBuffer() { return m_Color->GetPixels(); }
+		inline const uint32_t* GetColorBuffer() const { return m_Color->GetPixels(); }
+
+		// Padded so that 4 wide loads past the last pixel stay inside the allocation
+		inline float* GetDepthBuffer() { return m_Depth.data(); }
+
+	private:
+		FramebufferType m_Type;
+		uint32_t m_Width, m_Height;
+		Ref<SoftwareTexture2D> m_Color;
+		std::vector<float> m_Depth;
+		std::vector<std::shared_ptr<Texture2D>> m_Buffers;
+	};
+
+}
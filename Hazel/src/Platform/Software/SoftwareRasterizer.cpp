@@ -0,0 +1,393 @@
+#include "hzpch.h"
+#include "SoftwareRasterizer.h"
+
+#include <xmmintrin.h>
+
+namespace Hazel {
+
+	// Triangles set up and binned by one job, the bins of a chunk keep the submission order
+	static const uint32_t s_TrianglesPerChunk = 2048;
+
+	// Vertex positions are snapped to 1/256 of a pixel like GPU rasterizers do, which keeps
+	// shared edges of neighbouring triangles identical so no pixel is drawn twice or skipped
+	static const float s_SubpixelSteps = 256.0f;
+
+	template<typename T>
+	static const T& ReadAttribute(const uint8_t* vertex, uint32_t offset)
+	{
+		return *(const T*)(vertex + offset);
+	}
+
+	SoftwareRasterizer::SoftwareRasterizer(uint32_t threadCount)
+		: m_ThreadPool(threadCount)
+	{
+	}
+
+	void SoftwareRasterizer::Clear(SoftwareFramebuffer& target, const glm::vec4& color)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		uint32_t pixelCount = target.GetWidth() * target.GetHeight();
+		uint32_t packedColor = SoftwareTexture2D::PackTexel(
+			_mm_mul_ps(_mm_setr_ps(color.r, color.g, color.b, color.a), _mm_set1_ps(255.0f))
+		);
+		std::fill_n(target.GetColorBuffer(), pixelCount, packedColor);
+		std::fill_n(target.GetDepthBuffer(), pixelCount, 1.0f);
+	}
+
+	void SoftwareRasterizer::DrawIndexed(
+		const SoftwareDrawState& state,
+		const SoftwareVertexFormat& format,
+		const uint8_t* vertices,
+		const uint32_t* indices,
+		uint32_t indexCount
+	)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		uint32_t triangleCount = indexCount / 3;
+		if (triangleCount == 0 || !state.Target)
+			return;
+
+		SoftwareFramebuffer& target = *state.Target;
+		uint32_t tileCountX = (target.GetWidth() + TileSize - 1) / TileSize;
+		uint32_t tileCountY = (target.GetHeight() + TileSize - 1) / TileSize;
+		uint32_t tileCount = tileCountX * tileCountY;
+		uint32_t chunkCount = (triangleCount + s_TrianglesPerChunk - 1) / s_TrianglesPerChunk;
+
+		m_Triangles.resize(triangleCount);
+		if (m_Bins.size() < chunkCount * tileCount)
+			m_Bins.resize(chunkCount * tileCount);
+
+		{
+			HZ_PROFILE_SCOPE("SoftwareRasterizer::DrawIndexed - Setup")
+			m_ThreadPool.ParallelFor(chunkCount, [&](uint32_t chunk, uint32_t thread)
+			{
+				std::vector<uint32_t>* bins = &m_Bins[chunk * tileCount];
+				for (uint32_t tile = 0; tile < tileCount; tile++)
+					bins[tile].clear();
+
+				uint32_t first = chunk * s_TrianglesPerChunk;
+				uint32_t last = std::min(first + s_TrianglesPerChunk, triangleCount);
+				for (uint32_t i = first; i < last; i++)
+				{
+					const uint32_t* triangleIndices = &indices[i * 3];
+					Triangle& triangle = m_Triangles[i];
+					if (!SetupTriangle(
+						state,
+						format,
+						vertices + triangleIndices[0] * format.Stride,
+						vertices + triangleIndices[1] * format.Stride,
+						vertices + triangleIndices[2] * format.Stride,
+						triangle
+					))
+						continue;
+
+					uint32_t tileMinX = triangle.MinX / TileSize, tileMaxX = triangle.MaxX / TileSize;
+					uint32_t tileMinY = triangle.MinY / TileSize, tileMaxY = triangle.MaxY / TileSize;
+					for (uint32_t tileY = tileMinY; tileY <= tileMaxY; tileY++)
+						for (uint32_t tileX = tileMinX; tileX <= tileMaxX; tileX++)
+							bins[tileY * tileCountX + tileX].push_back(i);
+				}
+			});
+		}
+
+		{
+			HZ_PROFILE_SCOPE("SoftwareRasterizer::DrawIndexed - Raster")
+			m_ThreadPool.ParallelFor(tileCount, [&](uint32_t tile, uint32_t thread)
+			{
+				int32_t tileMinX = (int32_t)((tile % tileCountX) * TileSize);
+				int32_t tileMinY = (int32_t)((tile / tileCountX) * TileSize);
+				int32_t tileMaxX = std::min(tileMinX + (int32_t)TileSize, (int32_t)target.GetWidth()) - 1;
+				int32_t tileMaxY = std::min(tileMinY + (int32_t)TileSize, (int32_t)target.GetHeight()) - 1;
+
+				for (uint32_t chunk = 0; chunk < chunkCount; chunk++)
+					for (uint32_t i : m_Bins[chunk * tileCount + tile])
+						RasterizeTile(target, m_Triangles[i], tileMinX, tileMinY, tileMaxX, tileMaxY);
+			});
+		}
+	}
+
+	bool SoftwareRasterizer::SetupTriangle(
+		const SoftwareDrawState& state,
+		const SoftwareVertexFormat& format,
+		const uint8_t* v0,
+		const uint8_t* v1,
+		const uint8_t* v2,
+		Triangle& triangle
+	) const
+	{
+		const uint8_t* vertices[3] = { v0, v1, v2 };
+
+		// Clip space to window space, y up with row 0 at the bottom like OpenGL
+		glm::vec3 window[3];
+		for (int i = 0; i < 3; i++)
+		{
+			glm::vec4 clip = state.ViewProjection * glm::vec4(ReadAttribute<glm::vec3>(vertices[i], format.Position), 1.0f);
+			glm::vec3 ndc = glm::vec3(clip) / clip.w;
+
+			float x = state.ViewportX + (ndc.x * 0.5f + 0.5f) * state.ViewportWidth;
+			float y = state.ViewportY + (ndc.y * 0.5f + 0.5f) * state.ViewportHeight;
+			window[i].x = roundf(x * s_SubpixelSteps) / s_SubpixelSteps;
+			window[i].y = roundf(y * s_SubpixelSteps) / s_SubpixelSteps;
+			window[i].z = ndc.z * 0.5f + 0.5f;
+		}
+
+		// Renderer2D does not enable face culling, so both windings are drawn. Reorder clockwise
+		// triangles so that the edge functions are positive inside.
+		float area = (window[1].x - window[0].x) * (window[2].y - window[0].y)
+			- (window[2].x - window[0].x) * (window[1].y - window[0].y);
+		if (area == 0.0f)
+			return false;
+		if (area < 0.0f)
+		{
+			std::swap(window[1], window[2]);
+			std::swap(vertices[1], vertices[2]);
+			area = -area;
+		}
+
+		float minX = std::min({ window[0].x, window[1].x, window[2].x });
+		float maxX = std::max({ window[0].x, window[1].x, window[2].x });
+		float minY = std::min({ window[0].y, window[1].y, window[2].y });
+		float maxY = std::max({ window[0].y, window[1].y, window[2].y });
+
+		// Pixels whose centers lie inside the bounds, clipped to the viewport and the target
+		int32_t clipMinX = std::max(state.ViewportX, 0);
+		int32_t clipMinY = std::max(state.ViewportY, 0);
+		int32_t clipMaxX = std::min(state.ViewportX + (int32_t)state.ViewportWidth, (int32_t)state.Target->GetWidth()) - 1;
+		int32_t clipMaxY = std::min(state.ViewportY + (int32_t)state.ViewportHeight, (int32_t)state.Target->GetHeight()) - 1;
+		triangle.MinX = std::max((int32_t)ceilf(minX - 0.5f), clipMinX);
+		triangle.MinY = std::max((int32_t)ceilf(minY - 0.5f), clipMinY);
+		triangle.MaxX = std::min((int32_t)floorf(maxX - 0.5f), clipMaxX);
+		triangle.MaxY = std::min((int32_t)floorf(maxY - 0.5f), clipMaxY);
+		if (triangle.MinX > triangle.MaxX || triangle.MinY > triangle.MaxY)
+			return false;
+
+		for (int i = 0; i < 3; i++)
+		{
+			const glm::vec3& a = window[(i + 1) % 3];
+			const glm::vec3& b = window[(i + 2) % 3];
+			triangle.A[i] = a.y - b.y;
+			triangle.B[i] = b.x - a.x;
+			triangle.C[i] = a.x * b.y - b.x * a.y;
+
+			// With counter-clockwise winding and y up, top edges run to the left and left edges run down
+			float dx = b.x - a.x, dy = b.y - a.y;
+			triangle.TopLeft[i] = (dy < 0.0f || (dy == 0.0f && dx < 0.0f)) ? 0xFFFFFFFF : 0;
+		}
+		triangle.InverseArea = 1.0f / area;
+
+		// The shader indexes u_Textures with int(v_TexIndex)
+		int32_t textureIndex = (int32_t)ReadAttribute<float>(vertices[0], format.TexIndex);
+		triangle.Texture = textureIndex >= 0 && textureIndex < 32 ? state.Textures[textureIndex] : nullptr;
+
+		glm::vec2 texelScale(1.0f);
+		if (triangle.Texture)
+			texelScale = glm::vec2((float)triangle.Texture->GetWidth(), (float)triangle.Texture->GetHeight());
+
+		glm::vec4 colors[3];
+		glm::vec2 texCoords[3];
+		for (int i = 0; i < 3; i++)
+		{
+			colors[i] = ReadAttribute<glm::vec4>(vertices[i], format.Color);
+			texCoords[i] = ReadAttribute<glm::vec2>(vertices[i], format.TexCoord)
+				* ReadAttribute<float>(vertices[i], format.TilingFactor)
+				* texelScale;
+		}
+
+		triangle.Z0 = window[0].z;
+		triangle.Z10 = window[1].z - window[0].z;
+		triangle.Z20 = window[2].z - window[0].z;
+		triangle.Color0 = colors[0];
+		triangle.Color10 = colors[1] - colors[0];
+		triangle.Color20 = colors[2] - colors[0];
+		triangle.TexCoord0 = texCoords[0];
+		triangle.TexCoord10 = texCoords[1] - texCoords[0];
+		triangle.TexCoord20 = texCoords[2] - texCoords[0];
+
+		// OpenGLTexture2D uses GL_LINEAR when minified and GL_NEAREST when magnified. The
+		// texel footprint of a pixel is constant across a triangle under affine interpolation.
+		glm::vec2 dx = (triangle.TexCoord10 * triangle.A[1] + triangle.TexCoord20 * triangle.A[2]) * triangle.InverseArea;
+		glm::vec2 dy = (triangle.TexCoord10 * triangle.B[1] + triangle.TexCoord20 * triangle.B[2]) * triangle.InverseArea;
+		triangle.Linear = triangle.Texture && std::max(glm::dot(dx, dx), glm::dot(dy, dy)) > 1.0f;
+
+		return true;
+	}
+
+	void SoftwareRasterizer::RasterizeTile(
+		SoftwareFramebuffer& target,
+		const Triangle& triangle,
+		int32_t tileMinX,
+		int32_t tileMinY,
+		int32_t tileMaxX,
+		int32_t tileMaxY
+	) const
+	{
+		int32_t minX = std::max(triangle.MinX, tileMinX), maxX = std::min(triangle.MaxX, tileMaxX);
+		int32_t minY = std::max(triangle.MinY, tileMinY), maxY = std::min(triangle.MaxY, tileMaxY);
+		if (minX > maxX || minY > maxY)
+			return;
+
+		uint32_t width = target.GetWidth();
+		uint32_t* colorBuffer = target.GetColorBuffer();
+		float* depthBuffer = target.GetDepthBuffer();
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+		const __m128 pixelMaxX = _mm_set1_ps((float)maxX + 1.0f);
+
+		__m128 edgeA[3], edgeB[3], edgeC[3], topLeft[3];
+		for (int i = 0; i < 3; i++)
+		{
+			edgeA[i] = _mm_set1_ps(triangle.A[i]);
+			edgeB[i] = _mm_set1_ps(triangle.B[i]);
+			edgeC[i] = _mm_set1_ps(triangle.C[i]);
+			topLeft[i] = _mm_castsi128_ps(_mm_set1_epi32((int)triangle.TopLeft[i]));
+		}
+
+		// Attributes as a base and two deltas, one register per channel
+		struct Attribute { __m128 Base, Delta1, Delta2; };
+		auto attribute = [](float base, float delta1, float delta2)
+		{
+			return Attribute{ _mm_set1_ps(base), _mm_set1_ps(delta1), _mm_set1_ps(delta2) };
+		};
+		auto interpolate = [](const Attribute& a, __m128 w1, __m128 w2)
+		{
+			return _mm_add_ps(a.Base, _mm_add_ps(_mm_mul_ps(w1, a.Delta1), _mm_mul_ps(w2, a.Delta2)));
+		};
+
+		const Attribute depthAttribute = attribute(triangle.Z0, triangle.Z10, triangle.Z20);
+		const Attribute u = attribute(triangle.TexCoord0.x, triangle.TexCoord10.x, triangle.TexCoord20.x);
+		const Attribute v = attribute(triangle.TexCoord0.y, triangle.TexCoord10.y, triangle.TexCoord20.y);
+		Attribute color[4];
+		for (int c = 0; c < 4; c++)
+			color[c] = attribute(triangle.Color0[c], triangle.Color10[c], triangle.Color20[c]);
+
+		const __m128 inverseArea = _mm_set1_ps(triangle.InverseArea);
+		const __m128 channelMax = _mm_set1_ps(255.0f);
+		const __m128 inverse255 = _mm_set1_ps(1.0f / 255.0f);
+		const __m128i byteMask = _mm_set1_epi32(0xFF);
+		const SoftwareTexture2D* texture = triangle.Texture;
+
+		for (int32_t y = minY; y <= maxY; y++)
+		{
+			__m128 pixelY = _mm_set1_ps((float)y + 0.5f);
+			__m128 rowEdges[3];
+			for (int i = 0; i < 3; i++)
+				rowEdges[i] = _mm_add_ps(_mm_mul_ps(edgeB[i], pixelY), edgeC[i]);
+
+			uint32_t* colorRow = colorBuffer + y * width;
+			float* depthRow = depthBuffer + y * width;
+
+			for (int32_t x = minX; x <= maxX; x += 4)
+			{
+				// Edges are evaluated directly rather than stepped, so no error builds up along a row
+				__m128 pixelX = _mm_add_ps(_mm_set1_ps((float)x), laneOffsets);
+				__m128 edges[3];
+				__m128 inside = _mm_cmplt_ps(pixelX, pixelMaxX);
+				for (int i = 0; i < 3; i++)
+				{
+					edges[i] = _mm_add_ps(_mm_mul_ps(edgeA[i], pixelX), rowEdges[i]);
+					__m128 covered = _mm_or_ps(
+						_mm_cmpgt_ps(edges[i], zero),
+						_mm_and_ps(_mm_cmpeq_ps(edges[i], zero), topLeft[i])
+					);
+					inside = _mm_and_ps(inside, covered);
+				}
+				if (!_mm_movemask_ps(inside))
+					continue;
+
+				// Lanes past maxX belong to the neighbouring tile, only touch them with full groups
+				bool fullGroup = x + 3 <= maxX;
+				alignas(16) uint32_t pixels[4] = {};
+				alignas(16) float depths[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+				if (fullGroup)
+				{
+					_mm_store_si128((__m128i*)pixels, _mm_loadu_si128((const __m128i*)(colorRow + x)));
+					_mm_store_ps(depths, _mm_loadu_ps(depthRow + x));
+				}
+				else
+				{
+					for (int lane = 0; x + lane <= maxX; lane++)
+					{
+						pixels[lane] = colorRow[x + lane];
+						depths[lane] = depthRow[x + lane];
+					}
+				}
+
+				// Depth clip to [0, 1] and GL_LESS against the stored depth
+				__m128 w1 = _mm_mul_ps(edges[1], inverseArea);
+				__m128 w2 = _mm_mul_ps(edges[2], inverseArea);
+				__m128 z = interpolate(depthAttribute, w1, w2);
+				__m128 depth = _mm_load_ps(depths);
+				__m128 write = _mm_and_ps(
+					_mm_and_ps(inside, _mm_cmplt_ps(z, depth)),
+					_mm_and_ps(_mm_cmpge_ps(z, zero), _mm_cmple_ps(z, one))
+				);
+				int mask = _mm_movemask_ps(write);
+				if (!mask)
+					continue;
+
+				// Texel fetches are the only per-pixel scalar work. Unbound samplers read opaque black.
+				alignas(16) uint32_t texels[4] = { 0xFF000000, 0xFF000000, 0xFF000000, 0xFF000000 };
+				if (texture)
+				{
+					alignas(16) float us[4], vs[4];
+					_mm_store_ps(us, interpolate(u, w1, w2));
+					_mm_store_ps(vs, interpolate(v, w1, w2));
+					for (int lane = 0; lane < 4; lane++)
+					{
+						if (mask & (1 << lane))
+						{
+							texels[lane] = triangle.Linear
+								? texture->SampleLinear(us[lane], vs[lane])
+								: texture->SampleNearest(us[lane], vs[lane]);
+						}
+					}
+				}
+
+				// Shade and blend with GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA on all four channels
+				__m128i texel = _mm_load_si128((const __m128i*)texels);
+				__m128i pixel = _mm_load_si128((const __m128i*)pixels);
+				__m128 source[4], destination[4];
+				for (int c = 0; c < 4; c++)
+				{
+					__m128i texelChannel = _mm_and_si128(_mm_srli_epi32(texel, c * 8), byteMask);
+					__m128i pixelChannel = _mm_and_si128(_mm_srli_epi32(pixel, c * 8), byteMask);
+					source[c] = _mm_mul_ps(_mm_cvtepi32_ps(texelChannel), interpolate(color[c], w1, w2));
+					source[c] = _mm_min_ps(_mm_max_ps(source[c], zero), channelMax);
+					destination[c] = _mm_cvtepi32_ps(pixelChannel);
+				}
+
+				__m128 alpha = _mm_mul_ps(source[3], inverse255);
+				__m128i blended = _mm_setzero_si128();
+				for (int c = 0; c < 4; c++)
+				{
+					__m128 result = _mm_add_ps(destination[c], _mm_mul_ps(_mm_sub_ps(source[c], destination[c]), alpha));
+					blended = _mm_or_si128(blended, _mm_slli_epi32(_mm_cvtps_epi32(result), c * 8));
+				}
+
+				__m128i writeMask = _mm_castps_si128(write);
+				__m128i result = _mm_or_si128(_mm_and_si128(writeMask, blended), _mm_andnot_si128(writeMask, pixel));
+				__m128 resultDepth = _mm_or_ps(_mm_and_ps(write, z), _mm_andnot_ps(write, depth));
+				if (fullGroup)
+				{
+					_mm_storeu_si128((__m128i*)(colorRow + x), result);
+					_mm_storeu_ps(depthRow + x, resultDepth);
+				}
+				else
+				{
+					_mm_store_si128((__m128i*)pixels, result);
+					_mm_store_ps(depths, resultDepth);
+					for (int lane = 0; x + lane <= maxX; lane++)
+					{
+						colorRow[x + lane] = pixels[lane];
+						depthRow[x + lane] = depths[lane];
+					}
+				}
+			}
+		}
+	}
+
+}
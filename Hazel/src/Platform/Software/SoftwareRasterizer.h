@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Hazel/Core/ThreadPool.h"
+
+#include "SoftwareFramebuffer.h"
+#include "SoftwareTexture.h"
+
+#include <glm/glm.hpp>
+
+namespace Hazel {
+
+	// Byte offsets of the Renderer2D quad attributes inside a vertex
+	struct SoftwareVertexFormat
+	{
+		uint32_t Stride;
+		uint32_t Position;      // float3
+		uint32_t Color;         // float4
+		uint32_t TexCoord;      // float2
+		uint32_t TexIndex;      // float
+		uint32_t TilingFactor;  // float
+	};
+
+	struct SoftwareDrawState
+	{
+		SoftwareFramebuffer* Target;
+		int32_t ViewportX, ViewportY;
+		uint32_t ViewportWidth, ViewportHeight;
+
+		glm::mat4 ViewProjection;
+		const SoftwareTexture2D* Textures[32]; // Unbound slots sample as opaque black
+	};
+
+	// Triangle rasterizer for the Renderer2D TextureColor program. Triangles are set up and
+	// binned into screen tiles in parallel, then every tile is shaded by one thread at a time in
+	// submission order, so blending gives the same result as the GPU regardless of thread count.
+	// Edge functions and depth testing run on 4 pixels at once with SSE.
+	//
+	// Matches OpenGLRendererAPI::Init: depth test GL_LESS with depth writes, and
+	// GL_SRC_ALPHA / GL_ONE_MINUS_SRC_ALPHA blending on all four channels. Interpolation is
+	// affine, which is exact for the orthographic projections Renderer2D uses.
+	class HAZEL_API SoftwareRasterizer
+	{
+	public:
+		// 0 = one thread per hardware thread
+		SoftwareRasterizer(uint32_t threadCount = 0);
+
+		inline uint32_t GetThreadCount() const { return m_ThreadPool.GetThreadCount(); }
+
+		void Clear(SoftwareFramebuffer& target, const glm::vec4& color);
+
+		void DrawIndexed(
+			const SoftwareDrawState& state,
+			const SoftwareVertexFormat& format,
+			const uint8_t* vertices,
+			const uint32_t* indices,
+			uint32_t indexCount
+		);
+
+	public:
+		static const uint32_t TileSize = 64;
+
+	private:
+		struct Triangle
+		{
+			// Edge i is opposite vertex i: E(x, y) = A * x + B * y + C, positive inside
+			float A[3], B[3], C[3];
+			uint32_t TopLeft[3];  // All bits set if pixels exactly on the edge are covered
+
+			float InverseArea;
+
+			// Attributes at vertex 0 and their deltas to vertices 1 and 2, texture coordinates in texels
+			float     Z0, Z10, Z20;
+			glm::vec4 Color0, Color10, Color20;
+			glm::vec2 TexCoord0, TexCoord10, TexCoord20;
+
+			const SoftwareTexture2D* Texture;
+			bool Linear; // Minified, sample with GL_LINEAR
+
+			int32_t MinX, MinY, MaxX, MaxY; // Covered pixels, inclusive
+		};
+
+		bool SetupTriangle(
+			const SoftwareDrawState& state,
+			const SoftwareVertexFormat& format,
+			const uint8_t* v0,
+			const uint8_t* v1,
+			const uint8_t* v2,
+			Triangle& triangle
+		) const;
+
+		void RasterizeTile(
+			SoftwareFramebuffer& target,
+			const Triangle& triangle,
+			int32_t tileMinX,
+			int32_t tileMinY,
+			int32_t tileMaxX,
+			int32_t tileMaxY
+		) const;
+
+	private:
+		ThreadPool m_ThreadPool;
+
+		std::vector<Triangle> m_Triangles;
+
+		// Triangle indices per (chunk, tile), chunks keep the submission order
+		std::vector<std::vector<uint32_t>> m_Bins;
+	};
+
+}
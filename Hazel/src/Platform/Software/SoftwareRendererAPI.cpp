@@ -0,0 +1,214 @@
+#include "hzpch.h"
+#include "SoftwareRendererAPI.h"
+
+#include "SoftwareBuffer.h"
+#include "SoftwareShader.h"
+#include "SoftwareUniformBuffer.h"
+
+namespace Hazel {
+
+	struct SoftwareUniformBinding
+	{
+		const SoftwareUniformBuffer* Buffer = nullptr;
+		uint32_t Offset = 0;
+	};
+
+	struct SoftwareContext
+	{
+		const SoftwareShader* Shader = nullptr;
+		const SoftwareTexture2D* Textures[32] = {};
+		SoftwareUniformBinding UniformBuffers[16];
+		SoftwareFramebuffer* Framebuffer = nullptr;
+		std::unique_ptr<SoftwareFramebuffer> DefaultFramebuffer;
+
+		int32_t ViewportX = 0, ViewportY = 0;
+		uint32_t ViewportWidth = 0, ViewportHeight = 0;
+		glm::vec4 ClearColor = { 0.0f, 0.0f, 0.0f, 0.0f };
+	};
+
+	static SoftwareContext s_Context;
+
+	void SoftwareRendererAPI::Init()
+	{
+		HZ_PROFILE_FUNCTION()
+		m_Rasterizer = std::make_unique<SoftwareRasterizer>();
+	}
+
+	void SoftwareRendererAPI::SetClearColor(const glm::vec4& color)
+	{
+		s_Context.ClearColor = color;
+	}
+
+	void SoftwareRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		s_Context.ViewportX = (int32_t)x;
+		s_Context.ViewportY = (int32_t)y;
+		s_Context.ViewportWidth = width;
+		s_Context.ViewportHeight = height;
+
+		// The default framebuffer follows the window, which is what the viewport is set to on resize.
+		// A viewport for a bound framebuffer leaves it alone.
+		if (s_Context.Framebuffer)
+			return;
+
+		auto& defaultFramebuffer = s_Context.DefaultFramebuffer;
+		if (!defaultFramebuffer || defaultFramebuffer->GetWidth() != x + width || defaultFramebuffer->GetHeight() != y + height)
+			defaultFramebuffer = std::make_unique<SoftwareFramebuffer>(FramebufferType::Texture2D, x + width, y + height);
+	}
+
+	void SoftwareRendererAPI::Clear()
+	{
+		SoftwareFramebuffer* target = s_Context.Framebuffer ? s_Context.Framebuffer : GetDefaultFramebuffer();
+		if (target)
+			m_Rasterizer->Clear(*target, s_Context.ClearColor);
+	}
+
+	void SoftwareRendererAPI::DrawIndexed(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t indexCount,
+		uint32_t baseVertex,
+		uint32_t firstIndex
+	)
+	{
+		HZ_PROFILE_FUNCTION()
+
+		SoftwareDrawState state;
+		state.Target = s_Context.Framebuffer ? s_Context.Framebuffer : GetDefaultFramebuffer();
+		if (!state.Target || !s_Context.Shader)
+			return;
+
+		const auto& vertexBuffers = vertexArray->GetVertexBuffers();
+		HZ_CORE_ASSERT(vertexBuffers.size() == 1, "Software renderer draws from a single vertex buffer!")
+		const auto& vertexBuffer = vertexBuffers[0];
+
+		// Position, color, texture coordinates, texture index and tiling factor as Renderer2D lays them out
+		const auto& elements = vertexBuffer->GetLayout().GetElements();
+		HZ_CORE_ASSERT(
+			elements.size() == 5
+			&& elements[0].Type == ShaderDataType::Float3
+			&& elements[1].Type == ShaderDataType::Float4
+			&& elements[2].Type == ShaderDataType::Float2
+			&& elements[3].Type == ShaderDataType::Float
+			&& elements[4].Type == ShaderDataType::Float,
+			"Software renderer only supports the Renderer2D quad vertex format!"
+		)
+
+		SoftwareVertexFormat format;
+		format.Stride = vertexBuffer->GetLayout().GetStride();
+		format.Position = elements[0].Offset;
+		format.Color = elements[1].Offset;
+		format.TexCoord = elements[2].Offset;
+		format.TexIndex = elements[3].Offset;
+		format.TilingFactor = elements[4].Offset;
+
+		auto storage = dynamic_cast<const SoftwareBufferStorage*>(vertexBuffer.get());
+		HZ_CORE_ASSERT(storage, "Vertex buffer was not created by the software renderer!")
+		auto indexBuffer = std::static_pointer_cast<SoftwareIndexBuffer>(vertexArray->GetIndexBuffer());
+		uint32_t count = indexCount ? indexCount : indexBuffer->GetCount();
+
+		state.ViewportX = s_Context.ViewportX;
+		state.ViewportY = s_Context.ViewportY;
+		state.ViewportWidth = s_Context.ViewportWidth;
+		state.ViewportHeight = s_Context.ViewportHeight;
+
+		// SceneData, the camera matrix is its first member
+		const SoftwareUniformBinding& sceneData = s_Context.UniformBuffers[0];
+		if (sceneData.Buffer)
+			memcpy(&state.ViewProjection, sceneData.Buffer->GetData() + sceneData.Offset, sizeof(glm::mat4));
+		else
+			state.ViewProjection = glm::mat4(1.0f);
+
+		std::copy(std::begin(s_Context.Textures), std::end(s_Context.Textures), state.Textures);
+
+		m_Rasterizer->DrawIndexed(
+			state,
+			format,
+			storage->GetData() + (size_t)baseVertex * format.Stride,
+			indexBuffer->GetIndices() + firstIndex,
+			count
+		);
+	}
+
+	void SoftwareRendererAPI::DrawArraysInstanced(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t vertexCount,
+		uint32_t instanceCount,
+		uint32_t baseInstance
+	)
+	{
+		HZ_CORE_ASSERT(false, "Software renderer does not support instanced drawing!")
+	}
+
+	void SoftwareRendererAPI::DrawIndexedInstanced(
+		const Ref<VertexArray>& vertexArray,
+		uint32_t instanceCount,
+		uint32_t baseInstance,
+		uint32_t indexCount
+	)
+	{
+		HZ_CORE_ASSERT(false, "Software renderer does not support instanced drawing!")
+	}
+
+	void SoftwareRendererAPI::DrawIndexedIndirect(
+		const Ref<VertexArray>& vertexArray,
+		const DrawIndexedIndirectCommand* commands,
+		uint32_t count
+	)
+	{
+		HZ_CORE_ASSERT(false, "Software renderer does not support instanced drawing!")
+	}
+
+	void SoftwareRendererAPI::BindShader(const SoftwareShader* shader)
+	{
+		s_Context.Shader = shader;
+	}
+
+	void SoftwareRendererAPI::UnbindShader(const SoftwareShader* shader)
+	{
+		if (s_Context.Shader == shader)
+			s_Context.Shader = nullptr;
+	}
+
+	void SoftwareRendererAPI::BindTexture(uint32_t slot, const SoftwareTexture2D* texture)
+	{
+		HZ_CORE_ASSERT(slot < 32, "Texture slot out of range!")
+		s_Context.Textures[slot] = texture;
+	}
+
+	void SoftwareRendererAPI::UnbindTexture(const SoftwareTexture2D* texture)
+	{
+		for (auto& slot : s_Context.Textures)
+			if (slot == texture)
+				slot = nullptr;
+	}
+
+	void SoftwareRendererAPI::BindUniformBuffer(uint32_t binding, const SoftwareUniformBuffer* buffer, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(binding < 16, "Uniform buffer binding out of range!")
+		s_Context.UniformBuffers[binding] = { buffer, offset };
+	}
+
+	void SoftwareRendererAPI::UnbindUniformBuffer(const SoftwareUniformBuffer* buffer)
+	{
+		for (auto& binding : s_Context.UniformBuffers)
+			if (binding.Buffer == buffer)
+				binding = {};
+	}
+
+	void SoftwareRendererAPI::BindFramebuffer(SoftwareFramebuffer* framebuffer)
+	{
+		s_Context.Framebuffer = framebuffer;
+	}
+
+	void SoftwareRendererAPI::UnbindFramebuffer(const SoftwareFramebuffer* framebuffer)
+	{
+		if (s_Context.Framebuffer == framebuffer)
+			s_Context.Framebuffer = nullptr;
+	}
+
+	SoftwareFramebuffer* SoftwareRendererAPI::GetDefaultFramebuffer()
+	{
+		return s_Context.DefaultFramebuffer.get();
+	}
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Hazel/Renderer/RendererAPI.h>
+
+#include "SoftwareRasterizer.h"
+
+namespace Hazel {
+
+	class SoftwareShader;
+	class SoftwareUniformBuffer;
+
+	// Backend that renders on the CPU with SoftwareRasterizer. Binding state lives here in place
+	// of a GL context: the Software objects register themselves when bound and unregister when
+	// destroyed. Without a bound framebuffer, draws go to a default framebuffer sized to the viewport.
+	// Draws run the Renderer2D TextureColor program on the standard quad vertex format and have
+	// finished writing the target when they return.
+	class HAZEL_API SoftwareRendererAPI : public RendererAPI
+	{
+	public:
+		virtual void Init() override;
+
+		virtual void SetClearColor(const glm::vec4& color) override;
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+		virtual void Clear() override;
+		virtual void DrawIndexed(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t indexCount = 0,
+			uint32_t baseVertex = 0,
+			uint32_t firstIndex = 0
+		) override;
+		virtual void DrawArraysInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t vertexCount,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0
+		) override;
+		virtual void DrawIndexedInstanced(
+			const Ref<VertexArray>& vertexArray,
+			uint32_t instanceCount,
+			uint32_t baseInstance = 0,
+			uint32_t indexCount = 0
+		) override;
+		virtual void DrawIndexedIndirect(
+			const Ref<VertexArray>& vertexArray,
+			const DrawIndexedIndirectCommand* commands,
+			uint32_t count
+		) override;
+
+		virtual uint32_t GetMaxTextureSlots() const override { return 32; }
+
+		// Binds only set pointers, they are not tracked
+		virtual BindStatistics GetBindStats() const override { return {}; }
+		virtual void ResetBindStats() override {}
+
+		static void BindShader(const SoftwareShader* shader);
+		static void UnbindShader(const SoftwareShader* shader);
+		static void BindTexture(uint32_t slot, const SoftwareTexture2D* texture);
+		static void UnbindTexture(const SoftwareTexture2D* texture);
+		static void BindUniformBuffer(uint32_t binding, const SoftwareUniformBuffer* buffer, uint32_t offset);
+		static void UnbindUniformBuffer(const SoftwareUniformBuffer* buffer);
+		static void BindFramebuffer(SoftwareFramebuffer* framebuffer);
+		static void UnbindFramebuffer(const SoftwareFramebuffer* framebuffer);
+
+		// Target of draws while no framebuffer is bound, null before the first SetViewport
+		static SoftwareFramebuffer* GetDefaultFramebuffer();
+
+	private:
+		std::unique_ptr<SoftwareRasterizer> m_Rasterizer;
+	};
+
+}
@@ -0,0 +1,41 @@
+#include "hzpch.h"
+#include "SoftwareShader.h"
+
+#include "SoftwareRendererAPI.h"
+
+namespace Hazel {
+
+	SoftwareShader::SoftwareShader(const std::string& filepath)
+	{
+		// Extract name from filepath
+		auto lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		m_Name = filepath.substr(lastSlash, count);
+	}
+
+	SoftwareShader::SoftwareShader(
+		const std::string& name,
+		const std::string& vertexSrc,
+		const std::string& fragmentSrc
+	) : m_Name(name)
+	{
+	}
+
+	SoftwareShader::~SoftwareShader()
+	{
+		SoftwareRendererAPI::UnbindShader(this);
+	}
+
+	void SoftwareShader::Bind() const
+	{
+		SoftwareRendererAPI::BindShader(this);
+	}
+
+	void SoftwareShader::Unbind() const
+	{
+		SoftwareRendererAPI::BindShader(nullptr);
+	}
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+
+namespace Hazel {
+
+	// The rasterizer runs a fixed Renderer2D TextureColor program, the sources are not compiled.
+	// It reads the camera from the SceneData uniform buffer, plain uniforms are ignored.
+	class HAZEL_API SoftwareShader : public Shader
+	{
+	public:
+		SoftwareShader(const std::string& filepath);
+		SoftwareShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		virtual ~SoftwareShader();
+
+		virtual void Bind() const override;
+		virtual void Unbind() const override;
+
+		virtual void SetInt(UniformId id, int value) override {}
+		virtual void SetIntArray(UniformId id, int* values, uint32_t count) override {}
+
+		virtual void SetFloat(UniformId id, float value) override {}
+		virtual void SetFloat2(UniformId id, const glm::vec2& value) override {}
+		virtual void SetFloat3(UniformId id, const glm::vec3& value) override {}
+		virtual void SetFloat4(UniformId id, const glm::vec4& value) override {}
+
+		virtual void SetMat3(UniformId id, const glm::mat3& value) override {}
+		virtual void SetMat4(UniformId id, const glm::mat4& value) override {}
+
+		virtual const std::string& GetName() const override { return m_Name; };
+
+	private:
+		std::string m_Name;
+	};
+
+}
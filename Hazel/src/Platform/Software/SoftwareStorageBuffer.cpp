@@ -0,0 +1,17 @@
+#include "hzpch.h"
+#include "SoftwareStorageBuffer.h"
+
+namespace Hazel {
+
+	SoftwareStorageBuffer::SoftwareStorageBuffer(uint32_t size)
+		: m_Data(size)
+	{
+	}
+
+	void SoftwareStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= m_Data.size(), "Data does not fit into the buffer!")
+		memcpy(m_Data.data() + offset, data, size);
+	}
+
+}
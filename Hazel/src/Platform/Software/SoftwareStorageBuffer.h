@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Hazel/Renderer/StorageBuffer.h"
+
+namespace Hazel {
+
+	// Only holds the data, the rasterizer has no programmable vertex stage to read it
+	class HAZEL_API SoftwareStorageBuffer : public StorageBuffer
+	{
+	public:
+		SoftwareStorageBuffer(uint32_t size);
+		virtual ~SoftwareStorageBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void Bind(uint32_t binding) const override {}
+
+		virtual uint32_t GetSize() const override { return (uint32_t)m_Data.size(); }
+
+		inline const uint8_t* GetData() const { return m_Data.data(); }
+
+	private:
+		std::vector<uint8_t> m_Data;
+	};
+
+}
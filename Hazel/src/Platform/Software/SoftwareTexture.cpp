@@ -0,0 +1,113 @@
+#include "hzpch.h"
+#include "SoftwareTexture.h"
+
+#include "SoftwareRendererAPI.h"
+
+#include "stb_image.h"
+
+namespace Hazel {
+
+	// Copies rows of RGB or RGBA pixels into RGBA8
+	static void ConvertPixels(
+		uint32_t* destination,
+		uint32_t destinationStride,
+		const uint8_t* source,
+		uint32_t width,
+		uint32_t height,
+		uint32_t channels
+	)
+	{
+		for (uint32_t y = 0; y < height; y++)
+		{
+			uint32_t* row = destination + y * destinationStride;
+			for (uint32_t x = 0; x < width; x++, source += channels)
+			{
+				uint32_t alpha = channels == 4 ? source[3] : 0xFF;
+				row[x] = source[0] | source[1] << 8 | source[2] << 16 | alpha << 24;
+			}
+		}
+	}
+
+	SoftwareTexture2D::SoftwareTexture2D(const std::string& path)
+		: m_Path(path), m_Width(0), m_Height(0), m_Channels(0)
+	{
+		HZ_PROFILE_FUNCTION()
+		stbi_set_flip_vertically_on_load(true);
+
+		int width, height, channels;
+		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+		HZ_CORE_ASSERT(data, "Failed to load image!")
+
+		Create(data, width, height, channels);
+
+		stbi_image_free(data);
+	}
+
+	SoftwareTexture2D::SoftwareTexture2D(
+		const void* data,
+		uint32_t width,
+		uint32_t height,
+		uint32_t channels
+	) : m_Path(""), m_Width(width), m_Height(height), m_Channels(channels)
+	{
+		HZ_PROFILE_FUNCTION()
+		Create(data, width, height, channels);
+	}
+
+	SoftwareTexture2D::~SoftwareTexture2D()
+	{
+		SoftwareRendererAPI::UnbindTexture(this);
+	}
+
+	void SoftwareTexture2D::Bind(uint32_t slot) const
+	{
+		SoftwareRendererAPI::BindTexture(slot, this);
+	}
+
+	void SoftwareTexture2D::SetData(void* data, uint32_t size)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(size == m_Width * m_Height * m_Channels, "Data must be entire texture!")
+		ConvertPixels(m_Pixels.data(), m_Width, (const uint8_t*)data, m_Width, m_Height, m_Channels);
+	}
+
+	void SoftwareTexture2D::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		HZ_PROFILE_FUNCTION()
+		HZ_CORE_ASSERT(x + width <= m_Width && y + height <= m_Height, "Region must be inside the texture!")
+		ConvertPixels(&m_Pixels[y * m_Width + x], m_Width, (const uint8_t*)data, width, height, m_Channels);
+	}
+
+	uint32_t SoftwareTexture2D::SampleLinear(float u, float v) const
+	{
+		u -= 0.5f;
+		v -= 0.5f;
+		int32_t u0 = FloorToInt(u), v0 = FloorToInt(v);
+		__m128 fu = _mm_set1_ps(u - (float)u0);
+		__m128 fv = _mm_set1_ps(v - (float)v0);
+
+		uint32_t x0 = WrapX(u0), x1 = WrapX(u0 + 1);
+		const uint32_t* row0 = &m_Pixels[WrapY(v0) * m_Width];
+		const uint32_t* row1 = &m_Pixels[WrapY(v0 + 1) * m_Width];
+
+		__m128 bottomLeft = UnpackTexel(row0[x0]), topLeft = UnpackTexel(row1[x0]);
+		__m128 bottom = _mm_add_ps(bottomLeft, _mm_mul_ps(_mm_sub_ps(UnpackTexel(row0[x1]), bottomLeft), fu));
+		__m128 top = _mm_add_ps(topLeft, _mm_mul_ps(_mm_sub_ps(UnpackTexel(row1[x1]), topLeft), fu));
+		return PackTexel(_mm_add_ps(bottom, _mm_mul_ps(_mm_sub_ps(top, bottom), fv)));
+	}
+
+	void SoftwareTexture2D::Create(const void* data, uint32_t width, uint32_t height, uint32_t channels)
+	{
+		HZ_CORE_ASSERT(channels == 3 || channels == 4, "Format not supported!")
+
+		m_Width = width;
+		m_Height = height;
+		m_Channels = channels;
+		m_PowerOfTwo = (width & (width - 1)) == 0 && (height & (height - 1)) == 0;
+
+		m_Pixels.resize(width * height, 0);
+		if (data)
+			ConvertPixels(m_Pixels.data(), width, (const uint8_t*)data, width, height, channels);
+	}
+
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+#include <glm/glm.hpp>
+
+#include <emmintrin.h>
+
+namespace Hazel {
+
+	// RGBA8 pixels in CPU memory, rows bottom to top like OpenGL. Sampling wraps with GL_REPEAT
+	// like OpenGLTexture2D, which samples nearest when magnified and linear when minified.
+	class HAZEL_API SoftwareTexture2D : public Texture2D
+	{
+	public:
+		SoftwareTexture2D(const std::string& path);
+		SoftwareTexture2D(const void* data, uint32_t width, uint32_t height, uint32_t channels);
+		virtual ~SoftwareTexture2D();
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual void SetData(void* data, uint32_t size) override;
+		virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+
+		virtual bool HasAlpha() const override { return m_Channels == 4; }
+
+		inline uint32_t* GetPixels() { return m_Pixels.data(); }
+		inline const uint32_t* GetPixels() const { return m_Pixels.data(); }
+
+		// u and v are in texels and not wrapped yet, results are RGBA8
+		inline uint32_t SampleNearest(float u, float v) const
+		{
+			return m_Pixels[WrapY(FloorToInt(v)) * m_Width + WrapX(FloorToInt(u))];
+		}
+		uint32_t SampleLinear(float u, float v) const;
+
+		// RGBA8 to floats in [0, 255]
+
+		static inline __m128 UnpackTexel(uint32_t texel)
+		{
+			__m128i zero = _mm_setzero_si128();
+			__m128i channels = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)texel), zero);
+			return _mm_cvtepi32_ps(_mm_unpacklo_epi16(channels, zero));
+		}
+
+		// Rounds and saturates to RGBA8
+		static inline uint32_t PackTexel(__m128 color)
+		{
+			__m128i channels = _mm_cvtps_epi32(color);
+			channels = _mm_packs_epi32(channels, channels);
+			return (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(channels, channels));
+		}
+
+	public:
+		bool operator==(const Texture& other) const override
+		{
+			return GetHandle() == other.GetHandle();
+		}
+
+	private:
+		void Create(const void* data, uint32_t width, uint32_t height, uint32_t channels);
+
+		static inline int32_t FloorToInt(float value)
+		{
+			int32_t truncated = (int32_t)value;
+			return truncated - (value < (float)truncated);
+		}
+
+		// GL_REPEAT, a mask for power of two sizes
+		inline uint32_t WrapX(int32_t x) const
+		{
+			if (m_PowerOfTwo)
+				return (uint32_t)x & (m_Width - 1);
+			int32_t wrapped = x % (int32_t)m_Width;
+			return (uint32_t)(wrapped < 0 ? wrapped + (int32_t)m_Width : wrapped);
+		}
+		inline uint32_t WrapY(int32_t y) const
+		{
+			if (m_PowerOfTwo)
+				return (uint32_t)y & (m_Height - 1);
+			int32_t wrapped = y % (int32_t)m_Height;
+			return (uint32_t)(wrapped < 0 ? wrapped + (int32_t)m_Height : wrapped);
+		}
+
+	private:
+		std::string m_Path;
+		uint32_t m_Width, m_Height, m_Channels;
+		bool m_PowerOfTwo = false;
+		std::vector<uint32_t> m_Pixels;
+	};
+
+}
@@ -0,0 +1,35 @@
+#include "hzpch.h"
+#include "SoftwareUniformBuffer.h"
+
+#include "SoftwareRendererAPI.h"
+
+namespace Hazel {
+
+	SoftwareUniformBuffer::SoftwareUniformBuffer(uint32_t size)
+		: m_Data(size)
+	{
+	}
+
+	SoftwareUniformBuffer::~SoftwareUniformBuffer()
+	{
+		SoftwareRendererAPI::UnbindUniformBuffer(this);
+	}
+
+	void SoftwareUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= m_Data.size(), "Data does not fit into the buffer!")
+		memcpy(m_Data.data() + offset, data, size);
+	}
+
+	void SoftwareUniformBuffer::Bind(uint32_t binding) const
+	{
+		SoftwareRendererAPI::BindUniformBuffer(binding, this, 0);
+	}
+
+	void SoftwareUniformBuffer::BindRange(uint32_t binding, uint32_t offset, uint32_t size) const
+	{
+		HZ_CORE_ASSERT(offset + size <= m_Data.size(), "Range is outside the buffer!")
+		SoftwareRendererAPI::BindUniformBuffer(binding, this, offset);
+	}
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Hazel/Renderer/UniformBuffer.h"
+
+namespace Hazel {
+
+	class HAZEL_API SoftwareUniformBuffer : public UniformBuffer
+	{
+	public:
+		SoftwareUniformBuffer(uint32_t size);
+		virtual ~SoftwareUniformBuffer();
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+		virtual void Bind(uint32_t binding) const override;
+		virtual void BindRange(uint32_t binding, uint32_t offset, uint32_t size) const override;
+
+		virtual uint32_t GetSize() const override { return (uint32_t)m_Data.size(); }
+		virtual uint32_t GetOffsetAlignment() const override { return 1; }
+
+		inline const uint8_t* GetData() const { return m_Data.data(); }
+
+	private:
+		std::vector<uint8_t> m_Data;
+	};
+
+}
@@ -0,0 +1,17 @@
+#include "hzpch.h"
+#include "SoftwareVertexArray.h"
+
+namespace Hazel {
+
+	void SoftwareVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!")
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+
+	void SoftwareVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+	{
+		m_IndexBuffer = indexBuffer;
+	}
+
+}
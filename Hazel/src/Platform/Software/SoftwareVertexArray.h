@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Hazel/Renderer/VertexArray.h"
+
+namespace Hazel {
+
+	// Draws read the buffers straight from the vertex array they are given
+	class HAZEL_API SoftwareVertexArray : public VertexArray
+	{
+	public:
+		SoftwareVertexArray() = default;
+		virtual ~SoftwareVertexArray() = default;
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+		virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+	private:
+		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+		Ref<IndexBuffer> m_IndexBuffer;
+	};
+
+}
@@ -4,6 +4,7 @@
 #include "Hazel/Events/ApplicationEvent.h"
 #include "Hazel/Events/MouseEvent.h"
 #include "Hazel/Events/KeyEvent.h"
+#include "Hazel/Renderer/RenderCommand.h"
 
 #include "Platform/OpenGL/OpenGLContext.h"
 
@@ -157,15 +158,18 @@ namespace Hazel {
 	void WindowsWindow::OnUpdate()
 	{
 		glfwPollEvents();
-		m_Context->SwapBuffers();
+		RenderCommand::Submit([context = m_Context]() { context->SwapBuffers(); });
 	}
 
 	void WindowsWindow::SetVSync(bool enabled)
 	{
-		if (enabled)
-			glfwSwapInterval(1);
-		else
-			glfwSwapInterval(0);
+		RenderCommand::Submit([enabled]()
+		{
+			if (enabled)
+				glfwSwapInterval(1);
+			else
+				glfwSwapInterval(0);
+		});
 
 		m_Data.VSync = enabled;
 	}
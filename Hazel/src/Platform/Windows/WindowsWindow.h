@@ -24,6 +24,7 @@ namespace Hazel {
 		bool IsVSync() const override;
 
 		inline virtual void* GetNativeWindow() const override { return m_Window; }
+		inline virtual GraphicsContext* GetContext() const override { return m_Context; }
 
 	private:
 		virtual void Init(const WindowProps& props);
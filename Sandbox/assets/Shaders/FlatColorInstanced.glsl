@@ -0,0 +1,31 @@
+#type vertex
+#version 450 core
+
+layout (location = 0) in vec3 a_Position;
+layout (location = 12) in mat4 a_Transform; // Per instance, see Renderer::SubmitInstanced
+
+layout (std140, binding = 0) uniform SceneData
+{
+    mat4 ViewProjection;
+    mat4 Transform; // Unused, the transform comes with the instance
+} u_SceneData;
+
+void main()
+{
+    gl_Position = u_SceneData.ViewProjection * a_Transform * vec4(a_Position, 1.0f);
+}
+
+#type fragment
+#version 450 core
+
+layout (location = 0) out vec4 FragColor;
+
+layout (std140, binding = 1) uniform RenderData
+{
+    vec3 Color;
+} u_RenderData;
+
+void main()
+{
+    FragColor = vec4(u_RenderData.Color, 1.0f);
+}
@@ -0,0 +1,64 @@
+#type vertex
+#version 450 core
+
+// Per instance
+layout (location = 0) in vec3  a_Center;
+layout (location = 1) in float a_Rotation;
+layout (location = 2) in vec2  a_Size;
+layout (location = 3) in vec4  a_Color;          // RGBA8, normalized
+layout (location = 4) in vec2  a_TexCoordMin;    // 16-bit, normalized
+layout (location = 5) in vec2  a_TexCoordMax;    // 16-bit, normalized
+layout (location = 6) in uint  a_TexIndexTiling; // bits 0-7: texture index, bits 16-31: half float tiling
+
+layout (location = 0) out vec4       v_Color;
+layout (location = 1) out vec2       v_TexCoord;
+layout (location = 2) flat out uint  v_TexIndex;
+layout (location = 3) flat out float v_TilingFactor;
+
+layout (std140, binding = 0) uniform SceneData
+{
+    mat4 ViewProjection;
+} u_SceneData;
+
+// Two triangles per quad, drawn with glDrawArraysInstanced(GL_TRIANGLES, 0, 6, quadCount)
+const vec2 c_Corners[4] = vec2[](
+    vec2(-0.5f, -0.5f),
+    vec2( 0.5f, -0.5f),
+    vec2( 0.5f,  0.5f),
+    vec2(-0.5f,  0.5f)
+);
+const int c_Indices[6] = int[](0, 1, 2, 2, 3, 0);
+
+void main()
+{
+    vec2 corner = c_Corners[c_Indices[gl_VertexID]];
+
+    vec2 local = corner * a_Size;
+    float s = sin(a_Rotation);
+    float c = cos(a_Rotation);
+    vec2 rotated = vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+    v_Color = a_Color;
+    v_TexCoord = mix(a_TexCoordMin, a_TexCoordMax, corner + 0.5f);
+    v_TexIndex = a_TexIndexTiling & 0xFFu;
+    v_TilingFactor = unpackHalf2x16(a_TexIndexTiling >> 16).x;
+    gl_Position = u_SceneData.ViewProjection * vec4(a_Center.xy + rotated, a_Center.z, 1.0f);
+}
+
+#type fragment
+#version 450 core
+
+layout (location = 0) in vec4       v_Color;
+layout (location = 1) in vec2       v_TexCoord;
+layout (location = 2) flat in uint  v_TexIndex;
+layout (location = 3) flat in float v_TilingFactor;
+
+layout (location = 0) out vec4 FragColor;
+
+uniform sampler2D u_Textures[HZ_MAX_TEXTURE_SLOTS];
+
+void main()
+{
+    FragColor = texture(u_Textures[v_TexIndex], v_TexCoord * v_TilingFactor);
+    FragColor *= v_Color;
+}
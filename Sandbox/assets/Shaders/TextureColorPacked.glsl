@@ -0,0 +1,44 @@
+#type vertex
+#version 450 core
+
+layout (location = 0) in vec3 a_Position;
+layout (location = 1) in vec4 a_Color;          // RGBA8, normalized
+layout (location = 2) in vec2 a_TexCoord;       // 16-bit, normalized
+layout (location = 3) in uint a_TexIndexTiling; // bits 0-7: texture index, bits 16-31: half float tiling
+
+layout (location = 0) out vec4       v_Color;
+layout (location = 1) out vec2       v_TexCoord;
+layout (location = 2) flat out uint  v_TexIndex;
+layout (location = 3) flat out float v_TilingFactor;
+
+layout (std140, binding = 0) uniform SceneData
+{
+    mat4 ViewProjection;
+} u_SceneData;
+
+void main()
+{
+    v_Color = a_Color;
+    v_TexCoord = a_TexCoord;
+    v_TexIndex = a_TexIndexTiling & 0xFFu;
+    v_TilingFactor = unpackHalf2x16(a_TexIndexTiling >> 16).x;
+    gl_Position = u_SceneData.ViewProjection * vec4(a_Position, 1.0f);
+}
+
+#type fragment
+#version 450 core
+
+layout (location = 0) in vec4       v_Color;
+layout (location = 1) in vec2       v_TexCoord;
+layout (location = 2) flat in uint  v_TexIndex;
+layout (location = 3) flat in float v_TilingFactor;
+
+layout (location = 0) out vec4 FragColor;
+
+uniform sampler2D u_Textures[HZ_MAX_TEXTURE_SLOTS];
+
+void main()
+{
+    FragColor = texture(u_Textures[v_TexIndex], v_TexCoord * v_TilingFactor);
+    FragColor *= v_Color;
+}
@@ -0,0 +1,71 @@
+#type vertex
+#version 450 core
+
+// One record per sprite, see SpriteBatch2D::Sprite
+struct Sprite
+{
+    vec4 CenterRotation;
+    vec2 Size;
+    uint Color;          // RGBA8, normalized
+    uint TexIndexTiling; // bits 0-7: texture index, bits 16-31: half float tiling
+    uint TexCoordMin;    // 16-bit, normalized
+    uint TexCoordMax;    // 16-bit, normalized
+};
+
+layout (std430, binding = 0) readonly buffer Sprites
+{
+    Sprite s_Sprites[];
+};
+
+layout (location = 0) out vec4       v_Color;
+layout (location = 1) out vec2       v_TexCoord;
+layout (location = 2) flat out uint  v_TexIndex;
+layout (location = 3) flat out float v_TilingFactor;
+
+layout (std140, binding = 0) uniform SceneData
+{
+    mat4 ViewProjection;
+} u_SceneData;
+
+// No vertex attributes, the index buffer gives every sprite the vertex IDs 4 * sprite + corner
+const vec2 c_Corners[4] = vec2[](
+    vec2(-0.5f, -0.5f),
+    vec2( 0.5f, -0.5f),
+    vec2( 0.5f,  0.5f),
+    vec2(-0.5f,  0.5f)
+);
+
+void main()
+{
+    Sprite sprite = s_Sprites[gl_VertexID / 4];
+    vec2 corner = c_Corners[gl_VertexID % 4];
+
+    vec2 local = corner * sprite.Size;
+    float s = sin(sprite.CenterRotation.w);
+    float c = cos(sprite.CenterRotation.w);
+    vec2 rotated = vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+    v_Color = unpackUnorm4x8(sprite.Color);
+    v_TexCoord = mix(unpackUnorm2x16(sprite.TexCoordMin), unpackUnorm2x16(sprite.TexCoordMax), corner + 0.5f);
+    v_TexIndex = sprite.TexIndexTiling & 0xFFu;
+    v_TilingFactor = unpackHalf2x16(sprite.TexIndexTiling >> 16).x;
+    gl_Position = u_SceneData.ViewProjection * vec4(sprite.CenterRotation.xy + rotated, sprite.CenterRotation.z, 1.0f);
+}
+
+#type fragment
+#version 450 core
+
+layout (location = 0) in vec4       v_Color;
+layout (location = 1) in vec2       v_TexCoord;
+layout (location = 2) flat in uint  v_TexIndex;
+layout (location = 3) flat in float v_TilingFactor;
+
+layout (location = 0) out vec4 FragColor;
+
+uniform sampler2D u_Textures[HZ_MAX_TEXTURE_SLOTS];
+
+void main()
+{
+    FragColor = texture(u_Textures[v_TexIndex], v_TexCoord * v_TilingFactor);
+    FragColor *= v_Color;
+}
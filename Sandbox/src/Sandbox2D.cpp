@@ -6,8 +6,14 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <chrono>
+#include <random>
+
+static const uint32_t s_SoftwareBenchmarkWidth = 1920, s_SoftwareBenchmarkHeight = 1080;
+
 Sandbox2D::Sandbox2D()
-	: Layer("Sandbox2D"), m_CameraController(1280.0f / 720.0f) {}
+	: Layer("Sandbox2D"), m_CameraController(1280.0f / 720.0f),
+	m_SoftwareCamera(0.0f, (float)s_SoftwareBenchmarkWidth, 0.0f, (float)s_SoftwareBenchmarkHeight) {}
 
 void Sandbox2D::OnAttach()
 {
@@ -15,6 +21,21 @@ void Sandbox2D::OnAttach()
 
 	m_PikaTex = Hazel::Texture2D::Create("assets/Textures/Pika.png");
 	m_CheckerboardTex = Hazel::Texture2D::Create("assets/Textures/Checkerboard.png");
+
+	m_BackgroundBatch = std::make_shared<Hazel::StaticBatch2D>(1);
+	m_BackgroundBatch->AddQuad({ -5.0f, -5.0f, -0.1f }, { 10.0f, 10.0f }, m_CheckerboardTex, 10.0f);
+
+	// 32 distinct 1x1 textures for the texture lookup benchmark
+	m_BenchmarkAtlas = std::make_shared<Hazel::TextureAtlas>(256, 256);
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		uint32_t color = 0xFF000000 | (i * 8) << 16 | (255 - i * 8) << 8 | 0x80;
+		auto texture = Hazel::Texture2D::Create(1, 1);
+		texture->SetData(&color, sizeof(uint32_t));
+		m_BenchmarkTextures.push_back(texture);
+
+		m_BenchmarkSubTextures.push_back(m_BenchmarkAtlas->Add(&color, 1, 1));
+	}
 }
 
 void Sandbox2D::OnDetach()
@@ -30,6 +51,13 @@ void Sandbox2D::OnUpdate(Hazel::Timestep ts)
 	// Update
 	m_CameraController.OnUpdate(ts);
 
+	// Offscreen, its quads are left out of the stats below
+	if (m_SoftwareBenchmark && Hazel::Renderer::GetAPI() == Hazel::RendererAPI::API::Software)
+		DrawSoftwareBenchmark();
+
+	Hazel::Renderer2D::ResetStats();
+	Hazel::RenderCommand::ResetBindStats();
+
 	// Update Pika rotation
 	s_PikaRotation += ts.GetMilliseconds() * 0.001f;
 
@@ -56,7 +84,6 @@ void Sandbox2D::OnUpdate(Hazel::Timestep ts)
 			m_PikaTintColor
 		);
 
-		/*
 		Hazel::Renderer2D::DrawRotatedQuad(
 			{ -0.7f, 0.0f }, 
 			{ 0.6f, 0.6f }, 
@@ -65,7 +92,6 @@ void Sandbox2D::OnUpdate(Hazel::Timestep ts)
 			1.0f,
 			m_PikaTintColor
 		);
-		*/
 		
 		Hazel::Renderer2D::DrawQuad(
 			{ 0.0f, -0.7f }, 
@@ -75,17 +101,173 @@ void Sandbox2D::OnUpdate(Hazel::Timestep ts)
 			m_PikaTintColor
 		);
 		
-		Hazel::Renderer2D::DrawQuad(
-			{ -5.0f, -5.0f, -0.1f },
-			{ 10.0f, 10.0f }, 
-			m_CheckerboardTex, 
-			10.0f
-		);
+		if (m_StaticBackground)
+		{
+			Hazel::Renderer2D::DrawStaticBatch(m_BackgroundBatch);
+		}
+		else
+		{
+			Hazel::Renderer2D::DrawQuad(
+				{ -5.0f, -5.0f, -0.1f },
+				{ 10.0f, 10.0f }, 
+				m_CheckerboardTex, 
+				10.0f
+			);
+		}
+
+		if (m_RotatedQuadBenchmark)
+		{
+			// Every quad is rotated, yet the grid still goes out in one draw call per full batch
+			HZ_PROFILE_SCOPE("Rotated Quad Benchmark")
+
+			for (int y = 0; y < m_BenchmarkGridSize; y++)
+			{
+				for (int x = 0; x < m_BenchmarkGridSize; x++)
+				{
+					glm::vec4 color = {
+						(float)x / m_BenchmarkGridSize,
+						0.4f,
+						(float)y / m_BenchmarkGridSize,
+						0.7f
+					};
+
+					Hazel::Renderer2D::DrawRotatedQuad(
+						{ x * 0.1f - 5.0f, y * 0.1f - 5.0f, -0.05f },
+						{ 0.08f, 0.08f },
+						s_PikaRotation + (x + y) * 0.1f,
+						color
+					);
+				}
+			}
+		}
+
+		if (m_TextureBenchmark)
+		{
+			// Interleaves the textures quad by quad, so every quad goes through the slot lookup
+			HZ_PROFILE_SCOPE("Texture Lookup Benchmark")
+
+			for (int y = 0; y < m_BenchmarkGridSize; y++)
+			{
+				for (int x = 0; x < m_BenchmarkGridSize; x++)
+				{
+					uint32_t index = (y * m_BenchmarkGridSize + x) % m_TextureBenchmarkCount;
+					glm::vec3 position = { x * 0.1f - 5.0f, y * 0.1f - 5.0f, -0.04f };
+
+					if (m_TextureBenchmarkAtlas)
+						Hazel::Renderer2D::DrawQuad(position, { 0.08f, 0.08f }, m_BenchmarkSubTextures[index]);
+					else
+						Hazel::Renderer2D::DrawQuad(position, { 0.08f, 0.08f }, m_BenchmarkTextures[index]);
+				}
+			}
+		}
+
+		if (m_SpriteBatchBenchmark)
+		{
+			// The grid stays on the GPU, only the sprites rotated this frame are uploaded
+			HZ_PROFILE_SCOPE("Sprite Batch Benchmark")
+
+			uint32_t gridSize = (uint32_t)m_BenchmarkGridSize;
+			auto getPosition = [gridSize](uint32_t index) -> glm::vec3
+			{
+				return { (index % gridSize) * 0.1f - 5.0f, (index / gridSize) * 0.1f - 5.0f, -0.03f };
+			};
+
+			uint32_t spriteCount = gridSize * gridSize;
+			if (!m_SpriteBatch || m_SpriteBatch->GetSpriteCount() != spriteCount)
+			{
+				m_SpriteBatch = std::make_shared<Hazel::SpriteBatch2D>(spriteCount);
+				for (uint32_t i = 0; i < spriteCount; i++)
+				{
+					glm::vec4 color = {
+						(float)(i % gridSize) / gridSize,
+						0.7f,
+						(float)(i / gridSize) / gridSize,
+						0.7f
+					};
+					m_SpriteBatch->AddSprite(getPosition(i), { 0.08f, 0.08f }, 0.0f, color);
+				}
+			}
+
+			for (int i = 0; i < m_SpriteBatchUpdates; i++)
+			{
+				uint32_t index = m_SpriteBatchCursor++ % spriteCount;
+				m_SpriteBatch->SetPosition(index, getPosition(index), s_PikaRotation);
+			}
+
+			Hazel::Renderer2D::DrawSpriteBatch(m_SpriteBatch);
+		}
 
 		Hazel::Renderer2D::EndScene();
 	}
 }
 
+void Sandbox2D::InitSoftwareBenchmark()
+{
+	HZ_PROFILE_FUNCTION()
+
+	const uint32_t quadCount = 100000;
+
+	m_SoftwareTarget.reset(Hazel::Framebuffer::Create(
+		Hazel::FramebufferType::Texture2D,
+		s_SoftwareBenchmarkWidth,
+		s_SoftwareBenchmarkHeight
+	));
+
+	// Fixed seed, so every run draws the same scene
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	m_SoftwareQuads.reserve(quadCount);
+	for (uint32_t i = 0; i < quadCount; i++)
+	{
+		glm::vec2 size = glm::vec2(4.0f + unit(random) * 28.0f);
+		glm::vec2 center = {
+			size.x * 0.5f + unit(random) * (s_SoftwareBenchmarkWidth - size.x),
+			size.y * 0.5f + unit(random) * (s_SoftwareBenchmarkHeight - size.y)
+		};
+		glm::vec4 color = { unit(random), unit(random), unit(random), 0.5f + unit(random) * 0.5f };
+
+		// Later quads are drawn on top
+		m_SoftwareQuads.push_back({ { center, -0.5f + i * (1.0f / quadCount) }, size, color, i % 3 });
+	}
+}
+
+void Sandbox2D::DrawSoftwareBenchmark()
+{
+	HZ_PROFILE_FUNCTION()
+
+	if (!m_SoftwareTarget)
+		InitSoftwareBenchmark();
+
+	// Every batch is rasterized by the time RenderCommand::DrawIndexed returns
+	auto start = std::chrono::high_resolution_clock::now();
+
+	m_SoftwareTarget->Bind();
+	Hazel::RenderCommand::SetViewport(0, 0, s_SoftwareBenchmarkWidth, s_SoftwareBenchmarkHeight);
+	Hazel::RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1.0f });
+	Hazel::RenderCommand::Clear();
+
+	// The checkerboard is magnified and Pika minified
+	Hazel::Renderer2D::BeginScene(m_SoftwareCamera);
+	for (const SoftwareBenchmarkQuad& quad : m_SoftwareQuads)
+	{
+		if (quad.Texture == 1)
+			Hazel::Renderer2D::DrawQuad(quad.Position, quad.Size, m_CheckerboardTex, 1.0f, quad.Color);
+		else if (quad.Texture == 2)
+			Hazel::Renderer2D::DrawQuad(quad.Position, quad.Size, m_PikaTex, 1.0f, quad.Color);
+		else
+			Hazel::Renderer2D::DrawQuad(quad.Position, quad.Size, quad.Color);
+	}
+	Hazel::Renderer2D::EndScene();
+
+	m_SoftwareTarget->Unbind();
+	Hazel::Window& window = Hazel::Application::Get().GetWindow();
+	Hazel::RenderCommand::SetViewport(0, 0, window.GetWidth(), window.GetHeight());
+
+	auto end = std::chrono::high_resolution_clock::now();
+	m_SoftwareBenchmarkTime = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
 void Sandbox2D::OnImGuiRender() 
 {
 	HZ_PROFILE_FUNCTION()
@@ -93,7 +275,71 @@ void Sandbox2D::OnImGuiRender()
 	ImGui::Begin("Settings");
 	ImGui::ColorEdit4("Square Color", glm::value_ptr(m_SquareColor));
 	ImGui::ColorEdit4("Pika Tint Color", glm::value_ptr(m_PikaTintColor));
+	ImGui::Checkbox("Static Background", &m_StaticBackground);
+	ImGui::Checkbox("Rotated Quad Benchmark", &m_RotatedQuadBenchmark);
+	ImGui::Checkbox("Texture Lookup Benchmark", &m_TextureBenchmark);
+	ImGui::RadioButton("1 Texture", &m_TextureBenchmarkCount, 1);
+	ImGui::SameLine();
+	ImGui::RadioButton("8 Textures", &m_TextureBenchmarkCount, 8);
+	ImGui::SameLine();
+	ImGui::RadioButton("32 Textures", &m_TextureBenchmarkCount, 32);
+	ImGui::Checkbox("Use Texture Atlas", &m_TextureBenchmarkAtlas);
+	ImGui::Checkbox("Sprite Batch Benchmark", &m_SpriteBatchBenchmark);
+	ImGui::SliderInt("Sprites Updated per Frame", &m_SpriteBatchUpdates, 0, 10000);
+	ImGui::SliderInt("Benchmark Grid Size", &m_BenchmarkGridSize, 1, 500);
+	ImGui::Checkbox("Software Rasterizer Benchmark", &m_SoftwareBenchmark);
+
+	// Compare vertex upload bandwidth of the quad submission modes
+	Hazel::Renderer2DSettings settings = Hazel::Renderer2D::GetSettings();
+	bool changed = ImGui::Checkbox("Packed Vertices", &settings.PackedVertices);
+	changed |= ImGui::Checkbox("Instanced Quads", &settings.Instanced);
+	changed |= ImGui::Checkbox("Streaming Buffer", &settings.StreamingBuffer);
+	changed |= ImGui::Checkbox("Sorted Quads", &settings.SortQuads);
+	changed |= ImGui::Checkbox("Frustum Culling", &settings.FrustumCulling);
+	if (changed)
+	{
+		Hazel::Renderer2D::Shutdown();
+		Hazel::Renderer2D::Init(settings);
+	}
 	ImGui::End();
+
+	auto stats = Hazel::Renderer2D::GetStats();
+	ImGui::Begin("Renderer2D Stats");
+	ImGui::Text("Draw Calls: %d", stats.DrawCalls);
+	ImGui::Text("Quads: %d", stats.QuadCount);
+	ImGui::Text("Culled Quads: %d", stats.CulledQuadCount);
+	ImGui::Text("Vertices: %d", stats.VertexCount);
+	ImGui::Text("Indices: %d", stats.IndexCount);
+	ImGui::Text("Texture Binds: %d", stats.TextureBinds);
+	ImGui::Text("Uploaded: %.2f KB", stats.BytesUploaded / 1024.0f);
+	ImGui::Text("Sprite Batch Uploads: %.2f KB", stats.SpriteBytesUploaded / 1024.0f);
+	if (stats.QuadCount)
+		ImGui::Text("Bytes per Quad: %d", (uint32_t)(stats.BytesUploaded / stats.QuadCount));
+
+	auto bindStats = Hazel::RenderCommand::GetBindStats();
+	ImGui::Text("Binds: %d", bindStats.Binds);
+	ImGui::Text("Skipped Binds: %d", bindStats.SkippedBinds);
+
+	auto cacheStats = Hazel::ShaderCache::GetStats();
+	ImGui::Text("Shader Cache Hits: %d / %d", cacheStats.Hits, cacheStats.Hits + cacheStats.Misses);
+	ImGui::End();
+
+	if (m_SoftwareBenchmark)
+	{
+		ImGui::Begin("Software Rasterizer");
+		if (Hazel::Renderer::GetAPI() != Hazel::RendererAPI::API::Software)
+		{
+			ImGui::Text("Needs RendererAPI::Software, see CreateApplication");
+		}
+		else if (m_SoftwareBenchmarkTime > 0.0f)
+		{
+			uint32_t quadCount = (uint32_t)m_SoftwareQuads.size();
+			ImGui::Text("%dx%d, %d quads through Renderer2D", s_SoftwareBenchmarkWidth, s_SoftwareBenchmarkHeight, quadCount);
+			ImGui::Text("Frame: %.2f ms", m_SoftwareBenchmarkTime);
+			ImGui::Text("Throughput: %.2f M quads/s", quadCount / m_SoftwareBenchmarkTime / 1000.0f);
+		}
+		ImGui::End();
+	}
 }
 
 void Sandbox2D::OnEvent(Hazel::Event& e)
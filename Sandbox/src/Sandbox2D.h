@@ -15,6 +15,10 @@ public:
 	virtual void OnImGuiRender() override;
 	virtual void OnEvent(Hazel::Event& e) override;
 
+private:
+	void InitSoftwareBenchmark();
+	void DrawSoftwareBenchmark();
+
 private:
 	Hazel::OrthographicCameraController m_CameraController;
 
@@ -24,6 +28,45 @@ private:
 	Hazel::Ref<Hazel::Texture2D> m_CheckerboardTex;
 	Hazel::Ref<Hazel::Texture2D> m_PikaTex;
 
+	// Checkerboard background, built once instead of every frame
+	bool m_StaticBackground = true;
+	Hazel::Ref<Hazel::StaticBatch2D> m_BackgroundBatch;
+
 	glm::vec4 m_PikaTintColor = glm::vec4(1.0f);
 	glm::vec4 m_SquareColor = { 0.2f, 0.3f, 0.8f, 1.0f };
+
+	// Benchmark
+	bool m_RotatedQuadBenchmark = false;
+	int m_BenchmarkGridSize = 50;
+
+	bool m_TextureBenchmark = false;
+	int m_TextureBenchmarkCount = 8; // Distinct textures: 1, 8 or 32
+	std::vector<Hazel::Ref<Hazel::Texture2D>> m_BenchmarkTextures;
+
+	// Same images packed into one atlas page
+	bool m_TextureBenchmarkAtlas = false;
+	Hazel::Ref<Hazel::TextureAtlas> m_BenchmarkAtlas;
+	std::vector<Hazel::Ref<Hazel::SubTexture2D>> m_BenchmarkSubTextures;
+
+	// Grid kept in a storage buffer, a few sprites are rotated per frame
+	bool m_SpriteBatchBenchmark = false;
+	int m_SpriteBatchUpdates = 100; // Sprites changed per frame
+	uint32_t m_SpriteBatchCursor = 0;
+	Hazel::Ref<Hazel::SpriteBatch2D> m_SpriteBatch;
+
+	// Software backend, Renderer2D draws into an offscreen 1920x1080 framebuffer before the frame.
+	// Only runs with RendererAPI::Software, see CreateApplication.
+	struct SoftwareBenchmarkQuad
+	{
+		glm::vec3 Position;
+		glm::vec2 Size;
+		glm::vec4 Color;
+		uint32_t Texture; // 0 = none, 1 = checkerboard, 2 = Pika
+	};
+
+	bool m_SoftwareBenchmark = false;
+	float m_SoftwareBenchmarkTime = 0.0f;
+	Hazel::OrthographicCamera m_SoftwareCamera;
+	std::unique_ptr<Hazel::Framebuffer> m_SoftwareTarget;
+	std::vector<SoftwareBenchmarkQuad> m_SoftwareQuads;
 };
\ No newline at end of file
@@ -65,29 +65,56 @@ public:
 			m_SquareVA->SetIndexBuffer(squareIB);
 		}
 
+		// Square and triangle sharing one vertex array, drawn by index range
+		{
+			m_ShapesVA = Hazel::VertexArray::Create();
+
+			float shapeVertices[7 * 3] =
+			{
+				-0.5f, -0.5f, 0.0f,
+				 0.5f, -0.5f, 0.0f,
+				 0.5f,  0.5f, 0.0f,
+				-0.5f,  0.5f, 0.0f,
+
+				-0.5f, -0.5f, 0.0f,
+				 0.5f, -0.5f, 0.0f,
+				 0.0f,  0.5f, 0.0f
+			};
+			Hazel::Ref<Hazel::VertexBuffer> shapesVB;
+			shapesVB = Hazel::VertexBuffer::Create(shapeVertices, _countof(shapeVertices));
+			shapesVB->SetLayout({
+				{ Hazel::ShaderDataType::Float3, "a_Position" }
+			});
+			m_ShapesVA->AddVertexBuffer(shapesVB);
+
+			uint32_t shapeIndices[6 + 3] = { 0, 1, 2, 2, 3, 0,   0, 1, 2 };
+			Hazel::Ref<Hazel::IndexBuffer> shapesIB;
+			shapesIB = Hazel::IndexBuffer::Create(shapeIndices, _countof(shapeIndices));
+			m_ShapesVA->SetIndexBuffer(shapesIB);
+		}
+
 		// Shaders
 		{
-			m_Shader = Hazel::Shader::CreateFromSpirv(
-				"Shader",
-				"assets/Shaders/Compiled/Shader.vs",
-				"assets/Shaders/Compiled/Shader.fs"
-			);
-
-			m_FlatColorShader = Hazel::Shader::CreateFromSpirv(
-				"FlatColorShader3D",
-				"assets/Shaders/Compiled/FlatColor.vs",
-				"assets/Shaders/Compiled/FlatColor.fs"
-			);
-
-			m_TextureShader = Hazel::Shader::CreateFromSpirv(
-				"TextureShader",
-				"assets/Shaders/Compiled/Texture.vs",
-				"assets/Shaders/Compiled/Texture.fs"
-			);
+			auto shaders = m_ShaderLibrary.Load({
+				{ "Shader", "", "assets/Shaders/Compiled/Shader.vs", "assets/Shaders/Compiled/Shader.fs" },
+				{ "FlatColorShader3D", "", "assets/Shaders/Compiled/FlatColor.vs", "assets/Shaders/Compiled/FlatColor.fs" },
+				{ "TextureShader", "", "assets/Shaders/Compiled/Texture.vs", "assets/Shaders/Compiled/Texture.fs" },
+				{ "", "assets/Shaders/FlatColorInstanced.glsl" }
+			});
+			m_ShaderLibrary.WaitAll();
+
+			m_Shader = shaders[0].get();
+			m_FlatColorShader = shaders[1].get();
+			m_TextureShader = shaders[2].get();
+			m_FlatColorInstancedShader = shaders[3].get();
 
 			auto texShader = std::dynamic_pointer_cast<Hazel::OpenGLShader>(m_TextureShader);
 			texShader->Bind();
 			texShader->UploadUniformInt("u_Texture", 0);
+
+			// RenderData blocks, a std140 vec3 takes up a whole vec4
+			m_SquareColorBuffer = Hazel::UniformBuffer::Create(sizeof(glm::vec4));
+			m_TextureColorBuffer = Hazel::UniformBuffer::Create(sizeof(glm::vec4));
 		}
 
 		// Textures
@@ -95,20 +122,40 @@ public:
 			m_Texture = Hazel::Texture2D::Create("assets/textures/Checkerboard.png");
 			m_PikaTexture = Hazel::Texture2D::Create("assets/textures/Pika.png");
 		}
+
+		// Materials
+		{
+			m_FlatColorMaterial = std::make_shared<Hazel::Material>(m_FlatColorShader);
+			m_FlatColorMaterial->SetUniformBuffer(1, m_SquareColorBuffer);
+			m_FlatColorInstancedMaterial = std::make_shared<Hazel::Material>(m_FlatColorInstancedShader);
+			m_FlatColorInstancedMaterial->SetUniformBuffer(1, m_SquareColorBuffer);
+
+			m_CheckerboardMaterial = std::make_shared<Hazel::Material>(m_TextureShader);
+			m_CheckerboardMaterial->SetTexture(0, m_Texture);
+			m_CheckerboardMaterial->SetUniformBuffer(1, m_TextureColorBuffer);
+
+			// Drawn over the checkerboard
+			m_PikaMaterial = std::make_shared<Hazel::Material>(m_TextureShader);
+			m_PikaMaterial->SetTexture(0, m_PikaTexture);
+			m_PikaMaterial->SetUniformBuffer(1, m_TextureColorBuffer);
+			m_PikaMaterial->SetTransparent(true);
+		}
 	}
 
 	void OnUpdate(Hazel::Timestep ts) override
 	{
 		// Update
 		m_CameraController.OnUpdate(ts);
+		Hazel::Renderer::ResetStats();
 
 		// Render
 		Hazel::Renderer::BeginScene(m_CameraController.GetCamera());
 
-		auto glFlatColorShader = std::dynamic_pointer_cast<Hazel::OpenGLShader>(m_FlatColorShader);
-		glFlatColorShader->Bind();
-		glFlatColorShader->UploadUniformFloat3("u_RenderData.Color", m_SquareColor);
+		m_SquareColorBuffer->SetData(glm::value_ptr(m_SquareColor), sizeof(glm::vec3));
+		m_TextureColorBuffer->SetData(glm::value_ptr(m_TextureColor), sizeof(glm::vec3));
 
+		// Submits of the instanced shader are merged into one multi-draw, one command per shape
+		const auto& gridMaterial = m_InstancedGrid ? m_FlatColorInstancedMaterial : m_FlatColorMaterial;
 		glm::mat4 scale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
 		for (int y = 0; y < 20; y++)
 		{
@@ -117,21 +164,13 @@ public:
 				glm::vec3 pos(x * 0.11f, y * 0.11f, 0.0f);
 				glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos) * scale;
 
-				Hazel::Renderer::Submit(m_FlatColorShader, m_SquareVA, transform);
+				Hazel::Renderer::Submit(gridMaterial, m_ShapesVA, transform, (x + y) % 2 ? m_TriangleRange : m_SquareRange);
 			}
 		}
 
 		scale = glm::scale(glm::mat4(1.0f), glm::vec3(1.5f));
-		
-		auto glTexShader = std::dynamic_pointer_cast<Hazel::OpenGLShader>(m_TextureShader);
-		glTexShader->Bind();
-		glTexShader->UploadUniformFloat3("u_RenderData.Color", m_TextureColor);
-
-		m_Texture->Bind(0);
-		Hazel::Renderer::Submit(m_TextureShader, m_SquareVA, scale);
-
-		m_PikaTexture->Bind(0);
-		Hazel::Renderer::Submit(m_TextureShader, m_SquareVA, scale);
+		Hazel::Renderer::Submit(m_PikaMaterial, m_SquareVA, scale);
+		Hazel::Renderer::Submit(m_CheckerboardMaterial, m_SquareVA, scale);
 		
 		Hazel::Renderer::EndScene();
 	}
@@ -141,6 +180,16 @@ public:
 		ImGui::Begin("Settings", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
 		ImGui::ColorEdit3("Square Color", glm::value_ptr(m_SquareColor));
 		ImGui::ColorEdit3("Texture Color", glm::value_ptr(m_TextureColor));
+		ImGui::Checkbox("Instanced Grid", &m_InstancedGrid);
+
+		auto stats = Hazel::Renderer::GetStats();
+		ImGui::Text("Draw Calls: %d", stats.DrawCalls);
+		ImGui::Text("Meshes: %d", stats.MeshCount);
+		ImGui::Text("Shader Binds: %d", stats.ShaderBinds);
+		ImGui::Text("Material Binds: %d", stats.MaterialBinds);
+		ImGui::Text("Vertex Array Binds: %d", stats.VertexArrayBinds);
+		ImGui::Text("Indirect Commands: %d", stats.IndirectCommands);
+		ImGui::Text("State Changes Saved: %d", stats.StateChangesSaved);
 		ImGui::End();
 	}
 
@@ -152,13 +201,22 @@ public:
 private:
 	Hazel::OrthographicCameraController m_CameraController;
 
+	Hazel::ShaderLibrary m_ShaderLibrary;
 	Hazel::Ref<Hazel::Shader> m_Shader;
 	Hazel::Ref<Hazel::VertexArray> m_VertexArray;
 
 	Hazel::Ref<Hazel::Shader> m_FlatColorShader, m_TextureShader;
+	Hazel::Ref<Hazel::Shader> m_FlatColorInstancedShader;
+	Hazel::Ref<Hazel::Material> m_FlatColorMaterial, m_FlatColorInstancedMaterial;
+	Hazel::Ref<Hazel::Material> m_CheckerboardMaterial, m_PikaMaterial;
+	bool m_InstancedGrid = true;
 	Hazel::Ref<Hazel::VertexArray> m_SquareVA;
+	Hazel::Ref<Hazel::VertexArray> m_ShapesVA;
+	Hazel::IndexRange m_SquareRange = { 6, 0, 0 };
+	Hazel::IndexRange m_TriangleRange = { 3, 6, 4 };
 
 	Hazel::Ref<Hazel::Texture2D> m_Texture, m_PikaTexture;
+	Hazel::Ref<Hazel::UniformBuffer> m_SquareColorBuffer, m_TextureColorBuffer;
 	glm::vec3 m_TextureColor = { 1.0f, 1.0f, 1.0f };
 
 	glm::vec3 m_SquareColor = { 0.2f, 0.3f, 0.8f };
@@ -178,5 +236,8 @@ public:
 
 Hazel::Application* Hazel::CreateApplication()
 {
+	// Renders on the CPU, offscreen, while ImGui still goes through GL. Needed by the software
+	// rasterizer benchmark of Sandbox2D.
+	//Hazel::RendererAPI::SetAPI(Hazel::RendererAPI::API::Software);
 	return new Sandbox();
 }
\ No newline at end of file